@@ -0,0 +1,397 @@
+#include "filaconcorrente.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Índices escritos por threads diferentes ficam em linhas de cache
+// diferentes, para que uma thread não invalide a linha da outra
+#define LINHA_CACHE 64
+
+// Tentativas (cedendo a CPU entre elas) antes de dormir na FilaBloqueante
+#define TENTATIVAS_ANTES_DE_DORMIR 16
+
+// Bit mais alto do fim da FilaMPMC interna da FilaBloqueante: fila fechada
+#define FIM_FECHADO (SIZE_MAX / 2 + 1)
+
+typedef struct {
+    _Atomic size_t inicio;      // próximo a retirar (escrito só pelo consumidor)
+    char sep1[LINHA_CACHE - sizeof(size_t)];
+    _Atomic size_t fim;         // próximo a inserir (escrito só pelo produtor)
+    char sep2[LINHA_CACHE - sizeof(size_t)];
+    size_t mascara;
+    void **itens;
+} FilaSPSCStruct;
+
+typedef struct {
+    _Atomic size_t sequencia;   // == posição: livre para inserir; == posição + 1: ocupada
+    void *item;
+} CelulaMPMC;
+
+typedef struct {
+    _Atomic size_t fim;
+    char sep1[LINHA_CACHE - sizeof(size_t)];
+    _Atomic size_t inicio;
+    char sep2[LINHA_CACHE - sizeof(size_t)];
+    size_t mascara;
+    CelulaMPMC *celulas;
+} FilaMPMCStruct;
+
+typedef struct {
+    FilaMPMCStruct *fila;
+    _Atomic int consumidoresEsperando;
+    _Atomic int produtoresEsperando;
+    int sinaisItem;                     // sinais ainda não recebidos (sob a trava)
+    int sinaisEspaco;
+    pthread_mutex_t trava;
+    pthread_cond_t temItem;
+    pthread_cond_t temEspaco;
+} FilaBloqueanteStruct;
+
+/*________________________________ FUNÇÕES AUXILIARES INTERNAS ________________________________*/
+
+static size_t potenciaDe2(int capacidade, size_t minimo) {
+    size_t cap = minimo;
+    while (cap < (size_t) capacidade) {
+        cap *= 2;
+    }
+    return cap;
+}
+
+/*________________________________ FILA SPSC ________________________________*/
+
+FilaSPSC criaFilaSPSC(int capacidade) {
+    if (capacidade <= 0) {
+        return NULL;
+    }
+    FilaSPSCStruct *f = (FilaSPSCStruct*) malloc(sizeof(FilaSPSCStruct));
+    size_t cap = potenciaDe2(capacidade, 1);
+    void **itens = (f != NULL) ? (void**) malloc(cap * sizeof(void*)) : NULL;
+    if (itens == NULL) {
+        fprintf(stderr, "Erro: falha na alocação de memória para fila SPSC.\n");
+        free(f);
+        return NULL;
+    }
+    atomic_init(&f->inicio, 0);
+    atomic_init(&f->fim, 0);
+    f->mascara = cap - 1;
+    f->itens = itens;
+    return (FilaSPSC) f;
+}
+
+void destroiFilaSPSC(FilaSPSC f) {
+    if (f == NULL) {
+        return;
+    }
+    free(((FilaSPSCStruct*) f)->itens);
+    free(f);
+}
+
+bool enfileiraSPSC(FilaSPSC f, void *item) {
+    FilaSPSCStruct *fila = (FilaSPSCStruct*) f;
+    size_t fim = atomic_load_explicit(&fila->fim, memory_order_relaxed);
+    size_t inicio = atomic_load_explicit(&fila->inicio, memory_order_acquire);
+    if (fim - inicio > fila->mascara) {
+        return false;
+    }
+    fila->itens[fim & fila->mascara] = item;
+    // release: o item fica visível antes do novo fim
+    atomic_store_explicit(&fila->fim, fim + 1, memory_order_release);
+    return true;
+}
+
+bool desenfileiraSPSC(FilaSPSC f, void **item) {
+    FilaSPSCStruct *fila = (FilaSPSCStruct*) f;
+    size_t inicio = atomic_load_explicit(&fila->inicio, memory_order_relaxed);
+    size_t fim = atomic_load_explicit(&fila->fim, memory_order_acquire);
+    if (inicio == fim) {
+        return false;
+    }
+    *item = fila->itens[inicio & fila->mascara];
+    // release: a posição só é reaproveitada depois de lida
+    atomic_store_explicit(&fila->inicio, inicio + 1, memory_order_release);
+    return true;
+}
+
+/*________________________________ FILA MPMC ________________________________*/
+
+FilaMPMC criaFilaMPMC(int capacidade) {
+    if (capacidade <= 0) {
+        return NULL;
+    }
+    FilaMPMCStruct *f = (FilaMPMCStruct*) malloc(sizeof(FilaMPMCStruct));
+    size_t cap = potenciaDe2(capacidade, 2);
+    CelulaMPMC *celulas = (f != NULL) ? (CelulaMPMC*) malloc(cap * sizeof(CelulaMPMC)) : NULL;
+    if (celulas == NULL) {
+        fprintf(stderr, "Erro: falha na alocação de memória para fila MPMC.\n");
+        free(f);
+        return NULL;
+    }
+    for (size_t i = 0; i < cap; i++) {
+        atomic_init(&celulas[i].sequencia, i);
+        celulas[i].item = NULL;
+    }
+    atomic_init(&f->fim, 0);
+    atomic_init(&f->inicio, 0);
+    f->mascara = cap - 1;
+    f->celulas = celulas;
+    return (FilaMPMC) f;
+}
+
+void destroiFilaMPMC(FilaMPMC f) {
+    if (f == NULL) {
+        return;
+    }
+    free(((FilaMPMCStruct*) f)->celulas);
+    free(f);
+}
+
+// FECHADA só ocorre na fila interna de uma FilaBloqueante (FIM_FECHADO)
+typedef enum { INSERIU, CHEIA, FECHADA } ResultadoInsercao;
+
+static ResultadoInsercao tentaEnfileirar(FilaMPMCStruct *fila, void *item) {
+    size_t pos = atomic_load_explicit(&fila->fim, memory_order_relaxed);
+    CelulaMPMC *celula;
+
+    while (true) {
+        if (pos & FIM_FECHADO) {
+            return FECHADA;
+        }
+        celula = &fila->celulas[pos & fila->mascara];
+        size_t seq = atomic_load_explicit(&celula->sequencia, memory_order_acquire);
+        intptr_t diferenca = (intptr_t) seq - (intptr_t) pos;
+        if (diferenca == 0) {
+            // Posição livre: tenta reservá-la (falha se outro produtor chegou antes)
+            if (atomic_compare_exchange_weak_explicit(&fila->fim, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diferenca < 0) {
+            return CHEIA;   // a célula ainda guarda o item de uma volta anterior
+        } else {
+            pos = atomic_load_explicit(&fila->fim, memory_order_relaxed);
+        }
+    }
+
+    celula->item = item;
+    atomic_store_explicit(&celula->sequencia, pos + 1, memory_order_release);
+    return INSERIU;
+}
+
+bool enfileiraMPMC(FilaMPMC f, void *item) {
+    return tentaEnfileirar((FilaMPMCStruct*) f, item) == INSERIU;
+}
+
+bool desenfileiraMPMC(FilaMPMC f, void **item) {
+    FilaMPMCStruct *fila = (FilaMPMCStruct*) f;
+    size_t pos = atomic_load_explicit(&fila->inicio, memory_order_relaxed);
+    CelulaMPMC *celula;
+
+    while (true) {
+        celula = &fila->celulas[pos & fila->mascara];
+        size_t seq = atomic_load_explicit(&celula->sequencia, memory_order_acquire);
+        intptr_t diferenca = (intptr_t) seq - (intptr_t) (pos + 1);
+        if (diferenca == 0) {
+            if (atomic_compare_exchange_weak_explicit(&fila->inicio, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diferenca < 0) {
+            return false;   // célula ainda não preenchida: vazia
+        } else {
+            pos = atomic_load_explicit(&fila->inicio, memory_order_relaxed);
+        }
+    }
+
+    *item = celula->item;
+    // Libera a célula para a inserção da próxima volta do anel
+    atomic_store_explicit(&celula->sequencia, pos + fila->mascara + 1, memory_order_release);
+    return true;
+}
+
+/*________________________________ FILA BLOQUEANTE ________________________________*/
+
+FilaBloqueante criaFilaBloqueante(int capacidade) {
+    FilaBloqueanteStruct *f = (FilaBloqueanteStruct*) malloc(sizeof(FilaBloqueanteStruct));
+    if (f == NULL) {
+        fprintf(stderr, "Erro: falha na alocação de memória para fila bloqueante.\n");
+        return NULL;
+    }
+    f->fila = (FilaMPMCStruct*) criaFilaMPMC(capacidade);
+    if (f->fila == NULL) {
+        free(f);
+        return NULL;
+    }
+    atomic_init(&f->consumidoresEsperando, 0);
+    atomic_init(&f->produtoresEsperando, 0);
+    f->sinaisItem = 0;
+    f->sinaisEspaco = 0;
+    pthread_mutex_init(&f->trava, NULL);
+    pthread_cond_init(&f->temItem, NULL);
+    pthread_cond_init(&f->temEspaco, NULL);
+    return (FilaBloqueante) f;
+}
+
+void destroiFilaBloqueante(FilaBloqueante f) {
+    if (f == NULL) {
+        return;
+    }
+    FilaBloqueanteStruct *fila = (FilaBloqueanteStruct*) f;
+    destroiFilaMPMC(fila->fila);
+    pthread_mutex_destroy(&fila->trava);
+    pthread_cond_destroy(&fila->temItem);
+    pthread_cond_destroy(&fila->temEspaco);
+    free(fila);
+}
+
+/*
+ * Acorda um esperador, se houver, e o tira da contagem na hora ("reivindica"
+ * o esperador): sem isso ele continuaria contado até reaver a trava, e cada
+ * operação nesse meio-tempo pegaria a trava e sinalizaria de novo. O sinal
+ * vira uma ficha em 'sinais' (sob a trava), que diz a quem acordar que ele
+ * já saiu da contagem; quem acorda sem ficha (acordar espúrio, fechamento)
+ * continua contado.
+ *
+ * A barreira seq_cst ordena a operação que acabou de ser feita na fila
+ * antes da leitura do contador; do lado de quem espera, o incremento do
+ * contador vem antes da nova tentativa. Assim, ou quem espera vê a
+ * operação, ou quem a fez vê o contador (e, pela trava, só sinaliza depois
+ * que o outro já dorme).
+ */
+static void acordaSeEsperando(FilaBloqueanteStruct *f, _Atomic int *esperando, int *sinais, pthread_cond_t *cond) {
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(esperando, memory_order_relaxed) > 0) {
+        pthread_mutex_lock(&f->trava);
+        if (atomic_load_explicit(esperando, memory_order_relaxed) > 0) {
+            atomic_fetch_sub(esperando, 1);
+            (*sinais)++;
+            pthread_cond_signal(cond);
+        }
+        pthread_mutex_unlock(&f->trava);
+    }
+}
+
+/*
+ * Espera (com a trava) até a próxima tentativa. Na primeira vez só entra na
+ * contagem de 'esperando' e volta para tentar de novo antes de dormir.
+ */
+static void esperaVez(FilaBloqueanteStruct *f, _Atomic int *esperando, int *sinais, pthread_cond_t *cond, bool *contado) {
+    if (!*contado) {
+        atomic_fetch_add(esperando, 1);
+        atomic_thread_fence(memory_order_seq_cst);
+        *contado = true;
+        return;
+    }
+    pthread_cond_wait(cond, &f->trava);
+    if (*sinais > 0) {
+        (*sinais)--;
+        *contado = false;   // quem sinalizou já o descontou
+    }
+}
+
+static void deixaEspera(_Atomic int *esperando, bool contado) {
+    if (contado) {
+        atomic_fetch_sub(esperando, 1);
+    }
+}
+
+/*
+ * O fechamento liga FIM_FECHADO no fim da fila interna. Um produtor só
+ * insere reservando a posição com um CAS nesse mesmo fim (tentaEnfileirar),
+ * então ou a reserva vem antes do fechamento (e o item vai chegar), ou o
+ * CAS falha e o produtor vê a fila fechada: não há inserção perdida no
+ * meio, e nem um contador de produtores a pagar em cada operação.
+ */
+static bool estaFechada(FilaBloqueanteStruct *fila) {
+    return (atomic_load(&fila->fila->fim) & FIM_FECHADO) != 0;
+}
+
+/*
+ * Um consumidor que não conseguiu retirar só desiste com a fila fechada e
+ * todas as posições reservadas já retiradas. Uma posição reservada e ainda
+ * não preenchida é de um produtor no meio da inserção: esse item vai
+ * chegar e é preciso esperá-lo.
+ */
+static bool filaEsgotada(FilaBloqueanteStruct *fila) {
+    size_t fim = atomic_load(&fila->fila->fim);
+    return (fim & FIM_FECHADO) && atomic_load(&fila->fila->inicio) == (fim & ~FIM_FECHADO);
+}
+
+bool enfileiraBloqueante(FilaBloqueante f, void *item) {
+    FilaBloqueanteStruct *fila = (FilaBloqueanteStruct*) f;
+
+    // Fila cheia por pouco tempo é o caso comum: cede a CPU algumas vezes
+    // antes de pagar pela trava e pela condição
+    ResultadoInsercao r = tentaEnfileirar(fila->fila, item);
+    for (int t = 0; r == CHEIA && t < TENTATIVAS_ANTES_DE_DORMIR; t++) {
+        sched_yield();
+        r = tentaEnfileirar(fila->fila, item);
+    }
+
+    if (r == CHEIA) {
+        pthread_mutex_lock(&fila->trava);
+        bool contado = false;
+        while ((r = tentaEnfileirar(fila->fila, item)) == CHEIA) {
+            esperaVez(fila, &fila->produtoresEsperando, &fila->sinaisEspaco, &fila->temEspaco, &contado);
+        }
+        deixaEspera(&fila->produtoresEsperando, contado);
+        pthread_mutex_unlock(&fila->trava);
+    }
+    if (r == FECHADA) {
+        return false;
+    }
+
+    acordaSeEsperando(fila, &fila->consumidoresEsperando, &fila->sinaisItem, &fila->temItem);
+    return true;
+}
+
+bool desenfileiraBloqueante(FilaBloqueante f, void **item) {
+    FilaBloqueanteStruct *fila = (FilaBloqueanteStruct*) f;
+
+    bool retirou = desenfileiraMPMC(fila->fila, item);
+    for (int t = 0; !retirou && t < TENTATIVAS_ANTES_DE_DORMIR && !estaFechada(fila); t++) {
+        sched_yield();
+        retirou = desenfileiraMPMC(fila->fila, item);
+    }
+
+    if (!retirou) {
+        pthread_mutex_lock(&fila->trava);
+        bool contado = false;
+        while (!desenfileiraMPMC(fila->fila, item)) {
+            if (filaEsgotada(fila)) {
+                deixaEspera(&fila->consumidoresEsperando, contado);
+                pthread_mutex_unlock(&fila->trava);
+                return false;
+            }
+            if (estaFechada(fila)) {
+                // Falta só o item de uma inserção em andamento, que não
+                // sinaliza ninguém em particular (outro consumidor pode
+                // levá-lo): espera cedendo a CPU em vez de dormir
+                deixaEspera(&fila->consumidoresEsperando, contado);
+                contado = false;
+                pthread_mutex_unlock(&fila->trava);
+                sched_yield();
+                pthread_mutex_lock(&fila->trava);
+                continue;
+            }
+            esperaVez(fila, &fila->consumidoresEsperando, &fila->sinaisItem, &fila->temItem, &contado);
+        }
+        deixaEspera(&fila->consumidoresEsperando, contado);
+        pthread_mutex_unlock(&fila->trava);
+    }
+
+    acordaSeEsperando(fila, &fila->produtoresEsperando, &fila->sinaisEspaco, &fila->temEspaco);
+    return true;
+}
+
+void fechaFilaBloqueante(FilaBloqueante f) {
+    FilaBloqueanteStruct *fila = (FilaBloqueanteStruct*) f;
+    pthread_mutex_lock(&fila->trava);
+    atomic_fetch_or(&fila->fila->fim, FIM_FECHADO);
+    pthread_cond_broadcast(&fila->temItem);
+    pthread_cond_broadcast(&fila->temEspaco);
+    pthread_mutex_unlock(&fila->trava);
+}
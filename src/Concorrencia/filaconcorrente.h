@@ -0,0 +1,160 @@
+#ifndef FILACONCORRENTE_H
+#define FILACONCORRENTE_H
+
+#include <stdbool.h>
+
+/*
+*        TIPOS ABSTRATOS DE DADOS: FILAS CONCORRENTES LIMITADAS
+*
+*        Filas de capacidade fixa (potência de 2, arredondada para cima)
+*        para ligar etapas que rodam em threads diferentes, sem malloc por
+*        item. Os itens são ponteiros (void*); NULL é um item válido.
+*
+*        - FilaSPSC: um único produtor e um único consumidor. Cada
+*          operação é um punhado de leituras/escritas atômicas, sem laço
+*          (wait-free). Usar com mais de um produtor ou consumidor
+*          corrompe a fila.
+*        - FilaMPMC: vários produtores e consumidores. Cada posição do
+*          anel tem um número de sequência que diz se está livre ou
+*          ocupada; a disputa por uma posição se resolve com um
+*          compare-and-swap, sem travas (lock-free).
+*        - FilaBloqueante: uma FilaMPMC com espera. Enquanto há espaço
+*          (ou itens) as operações não usam a trava; só quem precisa
+*          esperar dorme numa variável de condição, e só é acordado se
+*          alguém estiver de fato esperando.
+*
+*        As operações não bloqueantes retornam false quando a fila está
+*        cheia (enfileirar) ou vazia (desenfileirar).
+*
+*        Usa <stdatomic.h> (C11); o gcc e o clang aceitam também com
+*        -std=c99.
+*/
+
+typedef void *FilaSPSC;
+typedef void *FilaMPMC;
+typedef void *FilaBloqueante;
+
+/*________________________________ FILA SPSC ________________________________*/
+
+/*
+Cria uma fila para um produtor e um consumidor.
+
+* capacidade: número máximo de itens (arredondado para potência de 2)
+
+Pré-condição: capacidade > 0
+Pós-condição: retorna a fila, ou NULL em caso de falha
+*/
+FilaSPSC criaFilaSPSC(int capacidade);
+
+/*
+Libera a fila (não os itens).
+
+Pré-condição: f válida ou NULL, sem threads usando-a
+Pós-condição: memória liberada
+*/
+void destroiFilaSPSC(FilaSPSC f);
+
+/*
+Insere um item no fim. Só pode ser chamada pela thread produtora.
+
+Pré-condição: f válida
+Pós-condição: retorna false (sem inserir) se a fila está cheia
+*/
+bool enfileiraSPSC(FilaSPSC f, void *item);
+
+/*
+Retira o item do início para *item. Só pode ser chamada pela thread
+consumidora.
+
+Pré-condição: f e item válidos
+Pós-condição: retorna false se a fila está vazia
+*/
+bool desenfileiraSPSC(FilaSPSC f, void **item);
+
+/*________________________________ FILA MPMC ________________________________*/
+
+/*
+Cria uma fila para vários produtores e consumidores.
+
+* capacidade: número máximo de itens (arredondado para potência de 2, mínimo 2)
+
+Pré-condição: capacidade > 0
+Pós-condição: retorna a fila, ou NULL em caso de falha
+*/
+FilaMPMC criaFilaMPMC(int capacidade);
+
+/*
+Libera a fila (não os itens).
+
+Pré-condição: f válida ou NULL, sem threads usando-a
+Pós-condição: memória liberada
+*/
+void destroiFilaMPMC(FilaMPMC f);
+
+/*
+Insere um item no fim; pode ser chamada por qualquer thread.
+
+Pré-condição: f válida
+Pós-condição: retorna false (sem inserir) se a fila está cheia
+*/
+bool enfileiraMPMC(FilaMPMC f, void *item);
+
+/*
+Retira o item do início para *item; pode ser chamada por qualquer thread.
+
+Pré-condição: f e item válidos
+Pós-condição: retorna false se a fila está vazia
+*/
+bool desenfileiraMPMC(FilaMPMC f, void **item);
+
+/*________________________________ FILA BLOQUEANTE ________________________________*/
+
+/*
+Cria uma fila MPMC com espera para produtores (fila cheia) e
+consumidores (fila vazia).
+
+* capacidade: número máximo de itens (ver criaFilaMPMC)
+
+Pré-condição: capacidade > 0
+Pós-condição: retorna a fila, ou NULL em caso de falha
+*/
+FilaBloqueante criaFilaBloqueante(int capacidade);
+
+/*
+Libera a fila (não os itens).
+
+Pré-condição: f válida ou NULL, sem threads usando-a
+Pós-condição: memória liberada
+*/
+void destroiFilaBloqueante(FilaBloqueante f);
+
+/*
+Insere um item no fim, esperando enquanto a fila estiver cheia.
+
+Pré-condição: f válida
+Pós-condição: retorna false (sem inserir) se a fila foi fechada
+*/
+bool enfileiraBloqueante(FilaBloqueante f, void *item);
+
+/*
+Retira o item do início para *item, esperando enquanto a fila estiver
+vazia e aberta.
+
+Pré-condição: f e item válidos
+Pós-condição: retorna false se a fila foi fechada e não há mais itens
+*/
+bool desenfileiraBloqueante(FilaBloqueante f, void **item);
+
+/*
+Fecha a fila: novas inserções falham e quem espera é acordado. Os
+consumidores ainda recebem os itens que já estavam na fila e os das
+inserções em andamento (que podem ainda retornar true); só depois
+desenfileiraBloqueante retorna false. Pode ser chamada com produtores
+ativos.
+
+Pré-condição: f válida
+Pós-condição: fila fechada
+*/
+void fechaFilaBloqueante(FilaBloqueante f);
+
+#endif
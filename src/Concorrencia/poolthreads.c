@@ -0,0 +1,192 @@
+#include "poolthreads.h"
+#include "fila.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct tarefa {
+    void (*funcao)(void*);
+    void *arg;
+} Tarefa;
+
+typedef struct poolThreads {
+    pthread_t *threads;
+    int numThreads;
+    Queue tarefas;
+    int pendentes;              // submetidas e ainda não concluídas
+    bool encerrando;
+    pthread_mutex_t trava;
+    pthread_cond_t temTarefa;
+    pthread_cond_t concluiu;
+} PoolThreadsStruct;
+
+/*                    FUNÇÕES AUXILIARES                    */
+
+static void* lacoTrabalhador(void *arg) {
+    PoolThreadsStruct *p = (PoolThreadsStruct*) arg;
+
+    while (true) {
+        pthread_mutex_lock(&p->trava);
+        while (estaVaziaFila(p->tarefas) && !p->encerrando) {
+            pthread_cond_wait(&p->temTarefa, &p->trava);
+        }
+        if (estaVaziaFila(p->tarefas)) {
+            pthread_mutex_unlock(&p->trava);
+            break;
+        }
+        Tarefa *t = (Tarefa*) desenfileira(p->tarefas);
+        pthread_mutex_unlock(&p->trava);
+
+        t->funcao(t->arg);
+        free(t);
+
+        pthread_mutex_lock(&p->trava);
+        p->pendentes--;
+        if (p->pendentes == 0) {
+            pthread_cond_broadcast(&p->concluiu);
+        }
+        pthread_mutex_unlock(&p->trava);
+    }
+
+    return NULL;
+}
+
+/*                    FUNÇÕES PÚBLICAS                    */
+
+PoolThreads criaPoolThreads(int numThreads) {
+    PoolThreadsStruct *p = (PoolThreadsStruct*) malloc(sizeof(PoolThreadsStruct));
+    if (p == NULL) {
+        fprintf(stderr, "Erro: falha ao alocar pool de threads.\n");
+        return NULL;
+    }
+
+    p->numThreads = (numThreads < 1) ? 1 : numThreads;
+    p->threads = NULL;
+    p->tarefas = NULL;
+    p->pendentes = 0;
+    p->encerrando = false;
+
+    if (p->numThreads == 1) {
+        return (PoolThreads) p;
+    }
+
+    p->tarefas = createQueue();
+    p->threads = (pthread_t*) malloc(p->numThreads * sizeof(pthread_t));
+    if (p->threads == NULL) {
+        fprintf(stderr, "Erro: falha ao alocar threads do pool.\n");
+        destroiFila(p->tarefas);
+        free(p);
+        return NULL;
+    }
+
+    pthread_mutex_init(&p->trava, NULL);
+    pthread_cond_init(&p->temTarefa, NULL);
+    pthread_cond_init(&p->concluiu, NULL);
+
+    int criadas = 0;
+    while (criadas < p->numThreads) {
+        if (pthread_create(&p->threads[criadas], NULL, lacoTrabalhador, p) != 0) {
+            fprintf(stderr, "Aviso: pool iniciado com %d de %d threads.\n", criadas, p->numThreads);
+            break;
+        }
+        criadas++;
+    }
+
+    if (criadas == 0) {
+        pthread_mutex_destroy(&p->trava);
+        pthread_cond_destroy(&p->temTarefa);
+        pthread_cond_destroy(&p->concluiu);
+        destroiFila(p->tarefas);
+        free(p->threads);
+        p->threads = NULL;
+        p->tarefas = NULL;
+        criadas = 1;
+    }
+    p->numThreads = criadas;
+
+    return (PoolThreads) p;
+}
+
+void destroiPoolThreads(PoolThreads pool) {
+    if (pool == NULL) {
+        return;
+    }
+
+    PoolThreadsStruct *p = (PoolThreadsStruct*) pool;
+
+    if (p->threads != NULL) {
+        pthread_mutex_lock(&p->trava);
+        p->encerrando = true;
+        pthread_cond_broadcast(&p->temTarefa);
+        pthread_mutex_unlock(&p->trava);
+
+        for (int i = 0; i < p->numThreads; i++) {
+            pthread_join(p->threads[i], NULL);
+        }
+
+        pthread_mutex_destroy(&p->trava);
+        pthread_cond_destroy(&p->temTarefa);
+        pthread_cond_destroy(&p->concluiu);
+        destroiFila(p->tarefas);
+        free(p->threads);
+    }
+
+    free(p);
+}
+
+bool submetePoolThreads(PoolThreads pool, void (*tarefa)(void*), void *arg) {
+    if (pool == NULL || tarefa == NULL) {
+        return false;
+    }
+
+    PoolThreadsStruct *p = (PoolThreadsStruct*) pool;
+
+    // Sem threads de trabalho: executa na hora, na thread chamadora
+    if (p->threads == NULL) {
+        tarefa(arg);
+        return true;
+    }
+
+    Tarefa *t = (Tarefa*) malloc(sizeof(Tarefa));
+    if (t == NULL) {
+        fprintf(stderr, "Erro: falha ao alocar tarefa do pool.\n");
+        return false;
+    }
+    t->funcao = tarefa;
+    t->arg = arg;
+
+    pthread_mutex_lock(&p->trava);
+    enfileira(p->tarefas, t);
+    p->pendentes++;
+    pthread_cond_signal(&p->temTarefa);
+    pthread_mutex_unlock(&p->trava);
+
+    return true;
+}
+
+void aguardaPoolThreads(PoolThreads pool) {
+    if (pool == NULL) {
+        return;
+    }
+
+    PoolThreadsStruct *p = (PoolThreadsStruct*) pool;
+    if (p->threads == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&p->trava);
+    while (p->pendentes > 0) {
+        pthread_cond_wait(&p->concluiu, &p->trava);
+    }
+    pthread_mutex_unlock(&p->trava);
+}
+
+int getNumThreadsPool(PoolThreads pool) {
+    if (pool == NULL) {
+        return 1;
+    }
+
+    PoolThreadsStruct *p = (PoolThreadsStruct*) pool;
+    return p->numThreads;
+}
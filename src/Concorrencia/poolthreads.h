@@ -0,0 +1,77 @@
+#ifndef POOLTHREADS_H
+#define POOLTHREADS_H
+
+#include <stdbool.h>
+
+/*
+*        TIPO ABSTRATO DE DADOS: POOL DE THREADS
+*
+*        Este módulo mantém um conjunto fixo de threads de trabalho que
+*        consomem tarefas de uma fila compartilhada (fila.h).
+*        Usado para calcular polígonos de visibilidade de comandos
+*        independentes do .qry em paralelo.
+*
+*        Com uma única thread o pool não cria threads: cada tarefa é
+*        executada imediatamente, na própria thread que a submeteu.
+*/
+
+typedef void *PoolThreads;
+
+/*                    FUNÇÕES DE CRIAÇÃO E DESTRUIÇÃO                    */
+
+/*
+Cria um pool com o número de threads informado.
+
+* numThreads: quantidade de threads de trabalho (valores < 1 viram 1)
+
+Pré-condição: nenhuma
+Pós-condição: retorna o pool criado, ou NULL em caso de falha
+*/
+PoolThreads criaPoolThreads(int numThreads);
+
+/*
+Aguarda as tarefas pendentes, encerra as threads e libera o pool.
+
+* pool: ponteiro para o pool
+
+Pré-condição: pool deve ser válido ou NULL
+Pós-condição: threads encerradas e memória liberada
+*/
+void destroiPoolThreads(PoolThreads pool);
+
+/*                    OPERAÇÕES                    */
+
+/*
+Submete uma tarefa ao pool.
+
+* pool: ponteiro para o pool
+* tarefa: função a ser executada por uma thread de trabalho
+* arg: argumento repassado à tarefa
+
+Pré-condição: pool e tarefa devem ser válidos
+Pós-condição: tarefa enfileirada (ou executada, se o pool tem 1 thread);
+              retorna true se sucesso
+*/
+bool submetePoolThreads(PoolThreads pool, void (*tarefa)(void*), void *arg);
+
+/*
+Bloqueia até que todas as tarefas submetidas tenham terminado.
+
+* pool: ponteiro para o pool
+
+Pré-condição: pool deve ser válido
+Pós-condição: nenhuma tarefa pendente ou em execução
+*/
+void aguardaPoolThreads(PoolThreads pool);
+
+/*
+Retorna o número de threads de trabalho do pool.
+
+* pool: ponteiro para o pool
+
+Pré-condição: pool deve ser válido
+Pós-condição: retorna o número de threads (1 se pool for NULL)
+*/
+int getNumThreadsPool(PoolThreads pool);
+
+#endif
@@ -7,6 +7,7 @@
 #include "linha.h"
 #include "texto.h"
 #include "poligono.h"
+#include "predicados.h"
 
 #include <math.h>
 #include <string.h>
@@ -267,9 +268,10 @@ void converterTextoParaLinha(Texto t, double *x1, double *y1, double *x2, double
 }
 
 int orientacaoTresPontos(double px, double py, double qx, double qy, double rx, double ry) {
-    double val = (qy - py) * (rx - qx) - (qx - px) * (ry - qy);
-    if (fabs(val) < 1e-10) return 0;  //colinear
-    return (val > 0) ? 1 : 2;  //1: horário, 2: anti-horário
+    // (qy - py) * (rx - qx) - (qx - px) * (ry - qy) = -orient2d(p, q, r), com sinal exato
+    int s = sinalOrient2d(px, py, qx, qy, rx, ry);
+    if (s == 0) return 0;  //colinear
+    return (s < 0) ? 1 : 2;  //1: horário, 2: anti-horário
 }
 
 bool pontoNoSegmentoCoord(double px, double py, double qx, double qy, double rx, double ry) {
@@ -103,7 +103,7 @@ px, py: coordenadas do ponto p
 qx, qy: coordenadas do ponto q
 rx, ry: coordenadas do ponto r
 
-Retorna: 0 se colineares, 1 se horário, 2 se anti-horário
+Retorna: 0 se colineares (teste exato), 1 se horário, 2 se anti-horário
 */
 int orientacaoTresPontos(double px, double py, double qx, double qy, double rx, double ry);
 
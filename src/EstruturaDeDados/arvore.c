@@ -6,6 +6,9 @@ typedef struct no {
     void *dado;
     struct no *esquerda;
     struct no *direita;
+    struct no *pai;
+    int altura;     // níveis da subárvore (folha = 1)
+    int tamanho;    // nós da subárvore (para posição / k-ésimo)
 } No;
 
 typedef struct arvore {
@@ -16,156 +19,160 @@ typedef struct arvore {
 
 /*                    FUNÇÕES AUXILIARES                    */
 
-static No* criaNo(void *dado) {
+static No* criaNo(void *dado, No *pai) {
     No *novo = (No*) malloc(sizeof(No));
     if (novo == NULL) {
         fprintf(stderr, "Erro: falha ao alocar nó da árvore.\n");
         return NULL;
     }
-    
+
     novo->dado = dado;
     novo->esquerda = NULL;
     novo->direita = NULL;
-    
+    novo->pai = pai;
+    novo->altura = 1;
+    novo->tamanho = 1;
+
     return novo;
 }
 
-static No* insereNoRec(No *raiz, void *dado, int (*compar)(const void *, const void *), bool *inseriu) {
-    if (raiz == NULL) {
-        *inseriu = true;
-        return criaNo(dado);
-    }
-    
-    int cmp = compar(dado, raiz->dado);
-    
-    if (cmp < 0) {
-        raiz->esquerda = insereNoRec(raiz->esquerda, dado, compar, inseriu);
-    } else if (cmp > 0) {
-        raiz->direita = insereNoRec(raiz->direita, dado, compar, inseriu);
-    } else {
-        *inseriu = false;
-    }
-    
-    return raiz;
+static int alturaNo(No *no) {
+    return (no != NULL) ? no->altura : 0;
 }
 
-static No* minimoNo(No *no) {
-    while (no != NULL && no->esquerda != NULL) {
-        no = no->esquerda;
-    }
-    return no;
+static int tamanhoNo(No *no) {
+    return (no != NULL) ? no->tamanho : 0;
 }
 
-static No* removeNoRec(No *raiz, void *dado, int (*compar)(const void *, const void *), void **removido) {
-    if (raiz == NULL) {
-        *removido = NULL;
-        return NULL;
-    }
-    
-    int cmp = compar(dado, raiz->dado);
-    
-    if (cmp < 0) {
-        raiz->esquerda = removeNoRec(raiz->esquerda, dado, compar, removido);
-    } else if (cmp > 0) {
-        raiz->direita = removeNoRec(raiz->direita, dado, compar, removido);
-    } else {
-        *removido = raiz->dado;
-        
-        if (raiz->esquerda == NULL) {
-            No *temp = raiz->direita;
-            free(raiz);
-            return temp;
-        } else if (raiz->direita == NULL) {
-            No *temp = raiz->esquerda;
-            free(raiz);
-            return temp;
-        }
-        
-        No *sucessor = minimoNo(raiz->direita);
-        raiz->dado = sucessor->dado;
-        raiz->direita = removeNoRec(raiz->direita, sucessor->dado, compar, &dado);
-        *removido = dado;
-    }
-    
-    return raiz;
+static void atualizaNo(No *no) {
+    int altEsq = alturaNo(no->esquerda);
+    int altDir = alturaNo(no->direita);
+    no->altura = 1 + ((altEsq > altDir) ? altEsq : altDir);
+    no->tamanho = 1 + tamanhoNo(no->esquerda) + tamanhoNo(no->direita);
 }
 
-static void* buscaNoRec(No *raiz, void *dado, int (*compar)(const void *, const void *)) {
-    if (raiz == NULL) {
-        return NULL;
-    }
-    
-    int cmp = compar(dado, raiz->dado);
-    
-    if (cmp < 0) {
-        return buscaNoRec(raiz->esquerda, dado, compar);
-    } else if (cmp > 0) {
-        return buscaNoRec(raiz->direita, dado, compar);
+// Faz o pai de 'antigo' (ou a raiz) apontar para 'novo'
+static void substituiFilho(ArvoreStruct *a, No *antigo, No *novo) {
+    No *pai = antigo->pai;
+    if (pai == NULL) {
+        a->raiz = novo;
+    } else if (pai->esquerda == antigo) {
+        pai->esquerda = novo;
     } else {
-        return raiz->dado;
+        pai->direita = novo;
+    }
+    if (novo != NULL) {
+        novo->pai = pai;
     }
 }
 
-static void destroiNosRec(No *raiz) {
-    if (raiz == NULL) {
-        return;
+static No* rotacionaEsquerda(ArvoreStruct *a, No *x) {
+    No *y = x->direita;
+    x->direita = y->esquerda;
+    if (y->esquerda != NULL) {
+        y->esquerda->pai = x;
+    }
+    substituiFilho(a, x, y);
+    y->esquerda = x;
+    x->pai = y;
+    atualizaNo(x);
+    atualizaNo(y);
+    return y;
+}
+
+static No* rotacionaDireita(ArvoreStruct *a, No *x) {
+    No *y = x->esquerda;
+    x->esquerda = y->direita;
+    if (y->direita != NULL) {
+        y->direita->pai = x;
+    }
+    substituiFilho(a, x, y);
+    y->direita = x;
+    x->pai = y;
+    atualizaNo(x);
+    atualizaNo(y);
+    return y;
+}
+
+/*
+ * Sobe de 'no' até a raiz atualizando altura e tamanho e girando onde o
+ * fator de balanceamento (AVL) passou de 1. Todo o caminho é visitado,
+ * já que os tamanhos mudam até a raiz: O(log n).
+ */
+static void rebalanceia(ArvoreStruct *a, No *no) {
+    while (no != NULL) {
+        atualizaNo(no);
+        int fator = alturaNo(no->esquerda) - alturaNo(no->direita);
+
+        if (fator > 1) {
+            if (alturaNo(no->esquerda->esquerda) < alturaNo(no->esquerda->direita)) {
+                rotacionaEsquerda(a, no->esquerda);
+            }
+            no = rotacionaDireita(a, no);
+        } else if (fator < -1) {
+            if (alturaNo(no->direita->direita) < alturaNo(no->direita->esquerda)) {
+                rotacionaDireita(a, no->direita);
+            }
+            no = rotacionaEsquerda(a, no);
+        }
+        no = no->pai;
     }
-    
-    destroiNosRec(raiz->esquerda);
-    destroiNosRec(raiz->direita);
-    free(raiz);
 }
 
-static void destroiNosCompletaRec(No *raiz, void (*destroiDado)(void*)) {
-    if (raiz == NULL) {
-        return;
+static No* minimoNo(No *no) {
+    while (no != NULL && no->esquerda != NULL) {
+        no = no->esquerda;
     }
-    
-    destroiNosCompletaRec(raiz->esquerda, destroiDado);
-    destroiNosCompletaRec(raiz->direita, destroiDado);
-    destroiDado(raiz->dado);
-    free(raiz);
+    return no;
 }
 
-static int alturaRec(No *raiz) {
-    if (raiz == NULL) {
-        return 0;
+static No* sucessorNo(No *no) {
+    if (no->direita != NULL) {
+        return minimoNo(no->direita);
     }
-    
-    int altEsq = alturaRec(raiz->esquerda);
-    int altDir = alturaRec(raiz->direita);
-    
-    return 1 + ((altEsq > altDir) ? altEsq : altDir);
+    while (no->pai != NULL && no->pai->direita == no) {
+        no = no->pai;
+    }
+    return no->pai;
 }
 
-static void percorreEmOrdemRec(No *raiz, void (*funcao)(void*, void*), void *contexto) {
-    if (raiz == NULL) {
-        return;
+static No* buscaNo(ArvoreStruct *a, void *dado) {
+    No *no = a->raiz;
+    while (no != NULL) {
+        int cmp = a->compar(dado, no->dado);
+        if (cmp == 0) {
+            return no;
+        }
+        no = (cmp < 0) ? no->esquerda : no->direita;
     }
-    
-    percorreEmOrdemRec(raiz->esquerda, funcao, contexto);
-    funcao(raiz->dado, contexto);
-    percorreEmOrdemRec(raiz->direita, funcao, contexto);
+    return NULL;
 }
 
-static void percorrePreOrdemRec(No *raiz, void (*funcao)(void*, void*), void *contexto) {
-    if (raiz == NULL) {
-        return;
+// Libera os nós sem pilha: gira à direita até não haver filho esquerdo
+static void destroiNos(No *no, void (*destroiDado)(void*)) {
+    while (no != NULL) {
+        if (no->esquerda != NULL) {
+            No *esq = no->esquerda;
+            no->esquerda = esq->direita;
+            esq->direita = no;
+            no = esq;
+        } else {
+            No *dir = no->direita;
+            if (destroiDado != NULL) {
+                destroiDado(no->dado);
+            }
+            free(no);
+            no = dir;
+        }
     }
-    
-    funcao(raiz->dado, contexto);
-    percorrePreOrdemRec(raiz->esquerda, funcao, contexto);
-    percorrePreOrdemRec(raiz->direita, funcao, contexto);
 }
 
-static void percorrePosOrdemRec(No *raiz, void (*funcao)(void*, void*), void *contexto) {
-    if (raiz == NULL) {
-        return;
+// Primeiro nó em pós-ordem da subárvore: desce preferindo a esquerda
+static No* primeiroPosOrdem(No *no) {
+    while (no->esquerda != NULL || no->direita != NULL) {
+        no = (no->esquerda != NULL) ? no->esquerda : no->direita;
     }
-    
-    percorrePosOrdemRec(raiz->esquerda, funcao, contexto);
-    percorrePosOrdemRec(raiz->direita, funcao, contexto);
-    funcao(raiz->dado, contexto);
+    return no;
 }
 
 /*                    FUNÇÕES PÚBLICAS                    */
@@ -174,17 +181,17 @@ Arvore criaArvore(int (*compar)(const void *, const void *)) {
     if (compar == NULL) {
         return NULL;
     }
-    
+
     ArvoreStruct *arv = (ArvoreStruct*) malloc(sizeof(ArvoreStruct));
     if (arv == NULL) {
         fprintf(stderr, "Erro: falha ao alocar árvore.\n");
         return NULL;
     }
-    
+
     arv->raiz = NULL;
     arv->tamanho = 0;
     arv->compar = compar;
-    
+
     return (Arvore) arv;
 }
 
@@ -192,9 +199,9 @@ void destroiArvore(Arvore arv) {
     if (arv == NULL) {
         return;
     }
-    
+
     ArvoreStruct *a = (ArvoreStruct*) arv;
-    destroiNosRec(a->raiz);
+    destroiNos(a->raiz, NULL);
     free(a);
 }
 
@@ -202,9 +209,9 @@ void destroiArvoreCompleta(Arvore arv, void (*destroiDado)(void*)) {
     if (arv == NULL || destroiDado == NULL) {
         return;
     }
-    
+
     ArvoreStruct *a = (ArvoreStruct*) arv;
-    destroiNosCompletaRec(a->raiz, destroiDado);
+    destroiNos(a->raiz, destroiDado);
     free(a);
 }
 
@@ -212,33 +219,59 @@ bool insereArvore(Arvore arv, void *dado) {
     if (arv == NULL) {
         return false;
     }
-    
+
     ArvoreStruct *a = (ArvoreStruct*) arv;
-    bool inseriu = false;
-    
-    a->raiz = insereNoRec(a->raiz, dado, a->compar, &inseriu);
-    
-    if (inseriu) {
-        a->tamanho++;
-    }
-    
-    return inseriu;
+    No *pai = NULL;
+    No **ref = &a->raiz;
+
+    while (*ref != NULL) {
+        pai = *ref;
+        int cmp = a->compar(dado, pai->dado);
+        if (cmp == 0) {
+            return false;
+        }
+        ref = (cmp < 0) ? &pai->esquerda : &pai->direita;
+    }
+
+    No *novo = criaNo(dado, pai);
+    if (novo == NULL) {
+        return false;
+    }
+    *ref = novo;
+    rebalanceia(a, pai);
+    a->tamanho++;
+
+    return true;
 }
 
 void* removeArvore(Arvore arv, void *dado) {
     if (arv == NULL) {
         return NULL;
     }
-    
+
     ArvoreStruct *a = (ArvoreStruct*) arv;
-    void *removido = NULL;
-    
-    a->raiz = removeNoRec(a->raiz, dado, a->compar, &removido);
-    
-    if (removido != NULL) {
-        a->tamanho--;
-    }
-    
+    No *no = buscaNo(a, dado);
+    if (no == NULL) {
+        return NULL;
+    }
+
+    void *removido = no->dado;
+
+    // Com dois filhos, o sucessor (sem filho esquerdo) toma o lugar do dado
+    // e é o nó que sai da árvore
+    if (no->esquerda != NULL && no->direita != NULL) {
+        No *sucessor = minimoNo(no->direita);
+        no->dado = sucessor->dado;
+        no = sucessor;
+    }
+
+    No *filho = (no->esquerda != NULL) ? no->esquerda : no->direita;
+    No *pai = no->pai;
+    substituiFilho(a, no, filho);
+    free(no);
+    rebalanceia(a, pai);
+    a->tamanho--;
+
     return removido;
 }
 
@@ -246,19 +279,19 @@ void* buscaArvore(Arvore arv, void *dado) {
     if (arv == NULL) {
         return NULL;
     }
-    
-    ArvoreStruct *a = (ArvoreStruct*) arv;
-    return buscaNoRec(a->raiz, dado, a->compar);
+
+    No *no = buscaNo((ArvoreStruct*) arv, dado);
+    return (no != NULL) ? no->dado : NULL;
 }
 
 void* minimoArvore(Arvore arv) {
     if (arv == NULL) {
         return NULL;
     }
-    
+
     ArvoreStruct *a = (ArvoreStruct*) arv;
     No *min = minimoNo(a->raiz);
-    
+
     return (min != NULL) ? min->dado : NULL;
 }
 
@@ -266,22 +299,70 @@ void* maximoArvore(Arvore arv) {
     if (arv == NULL) {
         return NULL;
     }
-    
+
     ArvoreStruct *a = (ArvoreStruct*) arv;
     No *no = a->raiz;
-    
+
     while (no != NULL && no->direita != NULL) {
         no = no->direita;
     }
-    
+
     return (no != NULL) ? no->dado : NULL;
 }
 
+int posicaoArvore(Arvore arv, void *dado) {
+    if (arv == NULL) {
+        return 0;
+    }
+
+    ArvoreStruct *a = (ArvoreStruct*) arv;
+    No *no = a->raiz;
+    int menores = 0;
+
+    while (no != NULL) {
+        int cmp = a->compar(dado, no->dado);
+        if (cmp <= 0) {
+            if (cmp == 0) {
+                return menores + tamanhoNo(no->esquerda);
+            }
+            no = no->esquerda;
+        } else {
+            menores += tamanhoNo(no->esquerda) + 1;
+            no = no->direita;
+        }
+    }
+
+    return menores;
+}
+
+void* getArvorePosicao(Arvore arv, int pos) {
+    if (arv == NULL || pos < 0) {
+        return NULL;
+    }
+
+    ArvoreStruct *a = (ArvoreStruct*) arv;
+    No *no = a->raiz;
+
+    while (no != NULL) {
+        int esq = tamanhoNo(no->esquerda);
+        if (pos < esq) {
+            no = no->esquerda;
+        } else if (pos == esq) {
+            return no->dado;
+        } else {
+            pos -= esq + 1;
+            no = no->direita;
+        }
+    }
+
+    return NULL;
+}
+
 int tamanhoArvore(Arvore arv) {
     if (arv == NULL) {
         return 0;
     }
-    
+
     ArvoreStruct *a = (ArvoreStruct*) arv;
     return a->tamanho;
 }
@@ -290,7 +371,7 @@ bool arvoreVazia(Arvore arv) {
     if (arv == NULL) {
         return true;
     }
-    
+
     ArvoreStruct *a = (ArvoreStruct*) arv;
     return a->raiz == NULL;
 }
@@ -299,34 +380,64 @@ int alturaArvore(Arvore arv) {
     if (arv == NULL) {
         return 0;
     }
-    
+
     ArvoreStruct *a = (ArvoreStruct*) arv;
-    return alturaRec(a->raiz);
+    return alturaNo(a->raiz);
 }
 
 void percorreEmOrdem(Arvore arv, void (*funcao)(void*, void*), void *contexto) {
     if (arv == NULL || funcao == NULL) {
         return;
     }
-    
+
     ArvoreStruct *a = (ArvoreStruct*) arv;
-    percorreEmOrdemRec(a->raiz, funcao, contexto);
+    for (No *no = minimoNo(a->raiz); no != NULL; no = sucessorNo(no)) {
+        funcao(no->dado, contexto);
+    }
 }
 
 void percorrePreOrdem(Arvore arv, void (*funcao)(void*, void*), void *contexto) {
     if (arv == NULL || funcao == NULL) {
         return;
     }
-    
+
     ArvoreStruct *a = (ArvoreStruct*) arv;
-    percorrePreOrdemRec(a->raiz, funcao, contexto);
+    No *no = a->raiz;
+
+    while (no != NULL) {
+        funcao(no->dado, contexto);
+        if (no->esquerda != NULL) {
+            no = no->esquerda;
+        } else if (no->direita != NULL) {
+            no = no->direita;
+        } else {
+            // Sobe até um ancestral cuja subárvore direita ainda não foi visitada
+            while (no->pai != NULL && (no->pai->direita == no || no->pai->direita == NULL)) {
+                no = no->pai;
+            }
+            no = (no->pai != NULL) ? no->pai->direita : NULL;
+        }
+    }
 }
 
 void percorrePosOrdem(Arvore arv, void (*funcao)(void*, void*), void *contexto) {
     if (arv == NULL || funcao == NULL) {
         return;
     }
-    
+
     ArvoreStruct *a = (ArvoreStruct*) arv;
-    percorrePosOrdemRec(a->raiz, funcao, contexto);
-}
\ No newline at end of file
+    if (a->raiz == NULL) {
+        return;
+    }
+
+    No *no = primeiroPosOrdem(a->raiz);
+    while (no != NULL) {
+        funcao(no->dado, contexto);
+        No *pai = no->pai;
+        if (pai != NULL && pai->esquerda == no && pai->direita != NULL) {
+            no = primeiroPosOrdem(pai->direita);
+        } else {
+            no = pai;
+        }
+    }
+}
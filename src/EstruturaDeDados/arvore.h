@@ -6,11 +6,15 @@
 /*
 *        TIPO ABSTRATO DE DADOS: ÁRVORE BINÁRIA DE BUSCA
 *
-*        Este módulo implementa uma árvore binária de busca (BST) genérica.
-*        Usada para armazenar segmentos ativos no algoritmo de visibilidade.
-*        
-*        A árvore mantém elementos ordenados segundo uma função de comparação,
-*        permitindo busca, inserção e remoção em O(log n) no caso médio.
+*        Este módulo implementa uma árvore binária de busca (BST) genérica,
+*        balanceada (AVL): a altura fica abaixo de 1,45 log2(n+2), então
+*        busca, inserção e remoção custam O(log n) mesmo com inserções em
+*        ordem.
+*
+*        Nenhuma operação é recursiva (os nós guardam o pai), então a
+*        profundidade da pilha não depende do tamanho da árvore. Cada nó
+*        guarda também o tamanho da sua subárvore, o que permite obter a
+*        posição de um elemento e o k-ésimo elemento em O(log n).
 */
 
 typedef void *Arvore;
@@ -109,6 +113,29 @@ Pós-condição: retorna o maior elemento, ou NULL se árvore vazia
 */
 void* maximoArvore(Arvore arv);
 
+/*
+Retorna quantos elementos da árvore são menores que 'dado' (a posição
+de 'dado' na ordem crescente, a partir de 0, se ele estiver na árvore).
+
+* arv: ponteiro para a árvore
+* dado: elemento de referência (não precisa estar na árvore)
+
+Pré-condição: arv deve ser válida
+Pós-condição: retorna um valor entre 0 e tamanhoArvore(arv)
+*/
+int posicaoArvore(Arvore arv, void *dado);
+
+/*
+Retorna o elemento de uma posição na ordem crescente (0 = o menor).
+
+* arv: ponteiro para a árvore
+* pos: posição (0-indexado)
+
+Pré-condição: arv deve ser válida
+Pós-condição: retorna o elemento, ou NULL se a posição é inválida
+*/
+void* getArvorePosicao(Arvore arv, int pos);
+
 /*                    OPERAÇÕES DE CONSULTA                    */
 
 /*
@@ -137,7 +164,7 @@ Retorna a altura da árvore (número de níveis).
 * arv: ponteiro para a árvore
 
 Pré-condição: arv deve ser válida
-Pós-condição: retorna a altura (0 se vazia)
+Pós-condição: retorna a altura (0 se vazia), em O(1)
 */
 int alturaArvore(Arvore arv);
 
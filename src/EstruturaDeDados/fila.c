@@ -1,29 +1,64 @@
 #include "fila.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
-// nó interno da fila
-typedef struct aux {
-    Item item;
-    struct aux *prox;
-} AUX;
+#define CAPACIDADE_INICIAL_FILA 16
 
-// estrutura da fila
+// estrutura da fila: buffer circular de itens
 typedef struct queue {
-    AUX *first;
-    AUX *last;
+    Item *itens;
+    int capacidade;   // sempre potência de 2
+    int first;        // posição do primeiro item
     int size;
 } filaC;
 
+// dobra a capacidade até caber 'necessario' itens, mantendo a ordem
+static void cresceFila(filaC *f, int necessario) {
+    int novaCap = f->capacidade;
+    while (novaCap < necessario) {
+        novaCap *= 2;
+    }
+    if (novaCap == f->capacidade) {
+        return;
+    }
+
+    Item *novo = (Item*) realloc(f->itens, (size_t) novaCap * sizeof(Item));
+    if (novo == NULL) {
+        printf("Erro: falha na alocação de memória.\n");
+        exit(1);
+    }
+
+    // os itens que davam a volta (do início do buffer) vão para logo
+    // depois da capacidade antiga, onde agora há espaço
+    int fimAntigo = f->first + f->size;
+    if (fimAntigo > f->capacidade) {
+        memcpy(novo + f->capacidade, novo, (size_t) (fimAntigo - f->capacidade) * sizeof(Item));
+    }
+    f->itens = novo;
+    f->capacidade = novaCap;
+}
+
 // cria uma fila vazia
 Queue createQueue() {
+    return createQueueCapacidade(CAPACIDADE_INICIAL_FILA);
+}
+
+// cria uma fila vazia com espaço para 'capacidade' itens
+Queue createQueueCapacidade(int capacidade) {
     filaC *f = (filaC*) malloc(sizeof(filaC));
-    if (f == NULL) {
+    int cap = CAPACIDADE_INICIAL_FILA;
+    while (cap < capacidade) {
+        cap *= 2;
+    }
+    Item *itens = (f != NULL) ? (Item*) malloc((size_t) cap * sizeof(Item)) : NULL;
+    if (itens == NULL) {
         printf("Erro: falha na alocação de memória.\n");
         exit(1);
     }
-    f->first = NULL;
-    f->last = NULL;
+    f->itens = itens;
+    f->capacidade = cap;
+    f->first = 0;
     f->size = 0;
     return (Queue) f;
 }
@@ -31,57 +66,75 @@ Queue createQueue() {
 // insere no final
 void enfileira(Queue q, Item i) {
     filaC *f = (filaC*) q;
-    AUX *novo = (AUX*) malloc(sizeof(AUX));
-    if (novo == NULL) {
-        printf("Erro: falha na alocação de memória.\n");
-        exit(1);
-    }
-    novo->item = i;
-    novo->prox = NULL;
-    
-    if (f->size == 0) {
-        f->first = novo;
-        f->last = novo;
-    } else {
-        f->last->prox = novo;
-        f->last = novo;
+    if (f->size == f->capacidade) {
+        cresceFila(f, f->size + 1);
     }
+    f->itens[(f->first + f->size) & (f->capacidade - 1)] = i;
     f->size++;
 }
 
+// insere n itens no final, na ordem do vetor
+void enfileiraVarios(Queue q, const Item *itens, int n) {
+    filaC *f = (filaC*) q;
+    if (n <= 0) {
+        return;
+    }
+    cresceFila(f, f->size + n);
+
+    // no máximo dois trechos contíguos: até o fim do buffer e a volta
+    int pos = (f->first + f->size) & (f->capacidade - 1);
+    int ateFim = f->capacidade - pos;
+    int primeiro = (n < ateFim) ? n : ateFim;
+    memcpy(f->itens + pos, itens, (size_t) primeiro * sizeof(Item));
+    memcpy(f->itens, itens + primeiro, (size_t) (n - primeiro) * sizeof(Item));
+    f->size += n;
+}
+
 // remove o primeiro elemento e retorna
 Item desenfileira(Queue q) {
     filaC *f = (filaC*) q;
     if (f->size == 0) {
         return NULL;
     }
-    AUX *temp = f->first;
-    Item info = temp->item;
-    f->first = f->first->prox;
-    if (f->first == NULL) {
-        f->last = NULL;
-    }
-    free(temp);
+    Item info = f->itens[f->first];
+    f->first = (f->first + 1) & (f->capacidade - 1);
     f->size--;
     return info;
 }
 
+// remove até 'max' itens do início para 'destino'; retorna quantos
+int desenfileiraVarios(Queue q, Item *destino, int max) {
+    filaC *f = (filaC*) q;
+    int n = (max < f->size) ? max : f->size;
+    if (n <= 0) {
+        return 0;
+    }
+
+    int ateFim = f->capacidade - f->first;
+    int primeiro = (n < ateFim) ? n : ateFim;
+    memcpy(destino, f->itens + f->first, (size_t) primeiro * sizeof(Item));
+    memcpy(destino + primeiro, f->itens, (size_t) (n - primeiro) * sizeof(Item));
+    f->first = (f->first + n) & (f->capacidade - 1);
+    f->size -= n;
+    return n;
+}
+
 // retorna o primeiro elemento sem remover
 Item inicioFila(const Queue q) {
     filaC *f = (filaC*) q;
-    if (f->first == NULL) {
+    if (f->size == 0) {
         return NULL;
     }
-    return f->first->item;
+    return f->itens[f->first];
 }
 
 // retorna o último elemento sem remover
 Item fimFila(const Queue q) {
     filaC *f = (filaC*) q;
-    if (f->last == NULL) {
+    if (f->size == 0) {
         return NULL;
     }
-    return f->last->item;
+    return f->itens[(f->first + f->size - 1) & (f->capacidade - 1)];
 }
 
 // verifica se a fila está vazia
@@ -106,11 +159,6 @@ void destroiFila(Queue q) {
         return;
     }
     filaC *f = (filaC*) q;
-    AUX *atual = f->first;
-    while (atual != NULL) {
-        AUX *prox = atual->prox;
-        free(atual);
-        atual = prox;
-    }
+    free(f->itens);
     free(f);
-}
\ No newline at end of file
+}
@@ -14,6 +14,11 @@
 
  O TAD é implementado utilizando ponteiros opacos (void *), ocultando
  a representação interna da estrutura.
+
+ Os itens ficam num buffer circular contíguo que dobra de tamanho quando
+ enche (nunca diminui): enfileirar e desenfileirar não alocam memória,
+ exceto no crescimento. enfileiraVarios/desenfileiraVarios movem blocos
+ de itens de uma vez.
 */
 
 
@@ -33,6 +38,17 @@ Queue Retorna um ponteiro opaco para a estrutura da Fila criada.
 */
 Queue createQueue();
 
+/*
+Cria uma nova fila vazia com espaço para 'capacidade' itens antes de
+precisar crescer.
+
+ capacidade: número de itens previsto
+
+ Nenhuma
+ Retorna um ponteiro opaco para a Fila criada.
+*/
+Queue createQueueCapacidade(int capacidade);
+
 
 /* ========== MODELO DOS COMENTARIOS ==========
                     * Explicação do que a função representa
@@ -51,11 +67,23 @@ Queue createQueue();
  q: ponteiro para a fila
  i: o item que sera enfileirado
 
- A fila não deve estar cheia 
+ A fila cresce quando necessário
  A fila conterá o novo elemento em seu final após este procedimento
 */
 void enfileira(Queue q, Item i);
 
+/*
+Insere n itens no final da fila, na ordem em que estão no vetor.
+
+ q: ponteiro para a fila
+ itens: vetor com os itens
+ n: quantidade de itens
+
+ A fila deve estar inicializada
+ A fila conterá os n itens em seu final (o buffer cresce uma vez, se preciso)
+*/
+void enfileiraVarios(Queue q, const Item *itens, int n);
+
 /*
 Retira o elemento do início da fila.
 
@@ -66,6 +94,18 @@ Retira o elemento do início da fila.
 */
 Item desenfileira(Queue q); 
 
+/*
+Retira até 'max' elementos do início da fila.
+
+ q: ponteiro para a fila
+ destino: vetor com espaço para 'max' itens
+ max: quantidade máxima de itens a retirar
+
+ A fila deve estar inicializada
+ Retorna quantos itens foram copiados para destino, na ordem da fila
+*/
+int desenfileiraVarios(Queue q, Item *destino, int max);
+
 /*
 Retornar o elemento do início da fila
 
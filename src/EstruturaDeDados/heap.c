@@ -0,0 +1,311 @@
+#include "heap.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define CAPACIDADE_INICIAL_HEAP 16
+
+typedef struct {
+    double prioridade;
+    void *dado;
+    int handle;
+} EntradaHeap;
+
+typedef struct heap {
+    EntradaHeap *entradas;      // o heap propriamente dito
+    int tamanho;
+    int capacidade;
+
+    int *posicao;               // handle -> índice em 'entradas' (-1: livre)
+    int *livres;                // pilha de handles livres
+    int qtdLivres;
+    int qtdHandles;             // handles já criados (tamanho usado de 'posicao')
+
+    int aridade;
+    int (*compar)(const void *, const void *);
+} HeapStruct;
+
+/*                    FUNÇÕES AUXILIARES                    */
+
+// true se 'a' deve sair antes de 'b'
+static inline bool precede(const HeapStruct *h, const EntradaHeap *a, const EntradaHeap *b) {
+    if (h->compar != NULL) {
+        int cmp = h->compar(a->dado, b->dado);
+        if (cmp != 0) {
+            return cmp < 0;
+        }
+    }
+    return a->prioridade < b->prioridade;
+}
+
+static inline void colocaEntrada(HeapStruct *h, int i, EntradaHeap e) {
+    h->entradas[i] = e;
+    h->posicao[e.handle] = i;
+}
+
+/*
+ * Sobe e desce "com buraco": a entrada que se move fica fora do vetor e
+ * só é escrita uma vez, na posição final, em vez de trocas sucessivas.
+ */
+static void sobe(HeapStruct *h, int i) {
+    EntradaHeap e = h->entradas[i];
+    while (i > 0) {
+        int pai = (i - 1) / h->aridade;
+        if (!precede(h, &e, &h->entradas[pai])) {
+            break;
+        }
+        colocaEntrada(h, i, h->entradas[pai]);
+        i = pai;
+    }
+    colocaEntrada(h, i, e);
+}
+
+static void desce(HeapStruct *h, int i) {
+    EntradaHeap e = h->entradas[i];
+    while (true) {
+        int primeiro = i * h->aridade + 1;
+        if (primeiro >= h->tamanho) {
+            break;
+        }
+        int ultimo = primeiro + h->aridade;
+        if (ultimo > h->tamanho) {
+            ultimo = h->tamanho;
+        }
+
+        int menor = primeiro;
+        for (int f = primeiro + 1; f < ultimo; f++) {
+            if (precede(h, &h->entradas[f], &h->entradas[menor])) {
+                menor = f;
+            }
+        }
+        if (!precede(h, &h->entradas[menor], &e)) {
+            break;
+        }
+        colocaEntrada(h, i, h->entradas[menor]);
+        i = menor;
+    }
+    colocaEntrada(h, i, e);
+}
+
+// Tira a entrada da posição i, tapando o buraco com a última
+static EntradaHeap retiraEntrada(HeapStruct *h, int i) {
+    EntradaHeap removida = h->entradas[i];
+    h->posicao[removida.handle] = -1;
+    h->livres[h->qtdLivres++] = removida.handle;
+
+    h->tamanho--;
+    if (i < h->tamanho) {
+        EntradaHeap ultima = h->entradas[h->tamanho];
+        colocaEntrada(h, i, ultima);
+        if (i > 0 && precede(h, &ultima, &h->entradas[(i - 1) / h->aridade])) {
+            sobe(h, i);
+        } else {
+            desce(h, i);
+        }
+    }
+    return removida;
+}
+
+static bool garanteCapacidade(HeapStruct *h) {
+    if (h->qtdHandles < h->capacidade) {
+        return true;
+    }
+
+    // entradas, posicao e livres crescem juntos: nunca há mais handles
+    // do que a capacidade
+    int novaCap = h->capacidade * 2;
+    EntradaHeap *entradas = (EntradaHeap*) realloc(h->entradas, (size_t) novaCap * sizeof(EntradaHeap));
+    if (entradas != NULL) {
+        h->entradas = entradas;
+    }
+    int *posicao = (int*) realloc(h->posicao, (size_t) novaCap * sizeof(int));
+    if (posicao != NULL) {
+        h->posicao = posicao;
+    }
+    int *livres = (int*) realloc(h->livres, (size_t) novaCap * sizeof(int));
+    if (livres != NULL) {
+        h->livres = livres;
+    }
+    if (entradas == NULL || posicao == NULL || livres == NULL) {
+        fprintf(stderr, "Erro: falha ao aumentar o heap.\n");
+        return false;
+    }
+    h->capacidade = novaCap;
+    return true;
+}
+
+static bool handleValido(const HeapStruct *h, int handle) {
+    return handle >= 0 && handle < h->qtdHandles && h->posicao[handle] >= 0;
+}
+
+/*                    FUNÇÕES PÚBLICAS                    */
+
+Heap criaHeap(int aridade, int (*compar)(const void *, const void *)) {
+    if (aridade < 2) {
+        return NULL;
+    }
+
+    HeapStruct *h = (HeapStruct*) malloc(sizeof(HeapStruct));
+    if (h == NULL) {
+        fprintf(stderr, "Erro: falha ao alocar heap.\n");
+        return NULL;
+    }
+    h->entradas = (EntradaHeap*) malloc(CAPACIDADE_INICIAL_HEAP * sizeof(EntradaHeap));
+    h->posicao = (int*) malloc(CAPACIDADE_INICIAL_HEAP * sizeof(int));
+    h->livres = (int*) malloc(CAPACIDADE_INICIAL_HEAP * sizeof(int));
+    if (h->entradas == NULL || h->posicao == NULL || h->livres == NULL) {
+        fprintf(stderr, "Erro: falha ao alocar heap.\n");
+        destroiHeap(h);
+        return NULL;
+    }
+
+    h->tamanho = 0;
+    h->capacidade = CAPACIDADE_INICIAL_HEAP;
+    h->qtdLivres = 0;
+    h->qtdHandles = 0;
+    h->aridade = aridade;
+    h->compar = compar;
+
+    return (Heap) h;
+}
+
+void destroiHeap(Heap heap) {
+    if (heap == NULL) {
+        return;
+    }
+
+    HeapStruct *h = (HeapStruct*) heap;
+    free(h->entradas);
+    free(h->posicao);
+    free(h->livres);
+    free(h);
+}
+
+int insereHeap(Heap heap, void *dado, double prioridade) {
+    if (heap == NULL) {
+        return -1;
+    }
+
+    HeapStruct *h = (HeapStruct*) heap;
+    int handle;
+    if (h->qtdLivres > 0) {
+        handle = h->livres[--h->qtdLivres];
+    } else {
+        if (!garanteCapacidade(h)) {
+            return -1;
+        }
+        handle = h->qtdHandles++;
+    }
+
+    EntradaHeap e = { prioridade, dado, handle };
+    colocaEntrada(h, h->tamanho, e);
+    h->tamanho++;
+    sobe(h, h->tamanho - 1);
+
+    return handle;
+}
+
+void* removeMinimoHeap(Heap heap, double *prioridade) {
+    if (heap == NULL) {
+        return NULL;
+    }
+
+    HeapStruct *h = (HeapStruct*) heap;
+    if (h->tamanho == 0) {
+        return NULL;
+    }
+
+    EntradaHeap removida = retiraEntrada(h, 0);
+    if (prioridade != NULL) {
+        *prioridade = removida.prioridade;
+    }
+    return removida.dado;
+}
+
+void* removeHeap(Heap heap, int handle) {
+    if (heap == NULL) {
+        return NULL;
+    }
+
+    HeapStruct *h = (HeapStruct*) heap;
+    if (!handleValido(h, handle)) {
+        return NULL;
+    }
+
+    return retiraEntrada(h, h->posicao[handle]).dado;
+}
+
+bool alteraPrioridadeHeap(Heap heap, int handle, double prioridade) {
+    if (heap == NULL) {
+        return false;
+    }
+
+    HeapStruct *h = (HeapStruct*) heap;
+    if (!handleValido(h, handle)) {
+        return false;
+    }
+
+    int i = h->posicao[handle];
+    h->entradas[i].prioridade = prioridade;
+    if (i > 0 && precede(h, &h->entradas[i], &h->entradas[(i - 1) / h->aridade])) {
+        sobe(h, i);
+    } else {
+        desce(h, i);
+    }
+    return true;
+}
+
+void* minimoHeap(Heap heap, double *prioridade) {
+    if (heap == NULL) {
+        return NULL;
+    }
+
+    HeapStruct *h = (HeapStruct*) heap;
+    if (h->tamanho == 0) {
+        return NULL;
+    }
+
+    if (prioridade != NULL) {
+        *prioridade = h->entradas[0].prioridade;
+    }
+    return h->entradas[0].dado;
+}
+
+bool getPrioridadeHeap(Heap heap, int handle, double *prioridade) {
+    if (heap == NULL) {
+        return false;
+    }
+
+    HeapStruct *h = (HeapStruct*) heap;
+    if (!handleValido(h, handle)) {
+        return false;
+    }
+
+    *prioridade = h->entradas[h->posicao[handle]].prioridade;
+    return true;
+}
+
+bool contemHeap(Heap heap, int handle) {
+    if (heap == NULL) {
+        return false;
+    }
+
+    return handleValido((HeapStruct*) heap, handle);
+}
+
+int tamanhoHeap(Heap heap) {
+    if (heap == NULL) {
+        return 0;
+    }
+
+    HeapStruct *h = (HeapStruct*) heap;
+    return h->tamanho;
+}
+
+bool heapVazio(Heap heap) {
+    if (heap == NULL) {
+        return true;
+    }
+
+    HeapStruct *h = (HeapStruct*) heap;
+    return h->tamanho == 0;
+}
@@ -0,0 +1,160 @@
+#ifndef HEAP_H
+#define HEAP_H
+
+#include <stdbool.h>
+
+/*
+*        TIPO ABSTRATO DE DADOS: HEAP (FILA DE PRIORIDADE)
+*
+*        Heap de mínimo d-ário guardado num vetor contíguo. Cada item é um
+*        dado (void*) com uma prioridade (double); sai primeiro o de menor
+*        prioridade. Com uma função de comparação, a ordem passa a ser a
+*        dos dados e a prioridade só desempata.
+*
+*        A aridade d (filhos por nó) troca profundidade por largura: com
+*        d = 4 a árvore tem metade dos níveis de um heap binário e os
+*        filhos de um nó ficam na mesma linha de cache, o que compensa em
+*        cargas com muitas alterações de prioridade (ex.: Dijkstra, k-NN).
+*
+*        Cada inserção devolve um identificador (handle) inteiro, que
+*        permite alterar a prioridade ou remover aquele item em O(log n)
+*        sem procurá-lo. O identificador vale enquanto o item estiver no
+*        heap; depois pode ser reaproveitado por outra inserção.
+*
+*        Inserir, remover e alterar prioridade: O(d log_d n).
+*        Consultar o mínimo: O(1).
+*
+*        Para itens de um tipo fixo guardados por valor, sem handles e sem
+*        chamada indireta ao comparador, ver heaptipado.h.
+*/
+
+typedef void *Heap;
+
+/*                    FUNÇÕES DE CRIAÇÃO E DESTRUIÇÃO                    */
+
+/*
+Cria um heap vazio.
+
+* aridade: número de filhos por nó (2 = heap binário)
+* compar: NULL para ordenar só pela prioridade; senão ordena pelos dados
+          (retorna <0 se a vem antes de b, 0 se empatam, >0 se depois)
+
+Pré-condição: aridade >= 2
+Pós-condição: retorna o heap, ou NULL em caso de falha
+*/
+Heap criaHeap(int aridade, int (*compar)(const void *, const void *));
+
+/*
+Libera o heap.
+IMPORTANTE: Não libera os dados armazenados.
+
+* h: ponteiro para o heap
+
+Pré-condição: h deve ser válido ou NULL
+Pós-condição: memória do heap é liberada
+*/
+void destroiHeap(Heap h);
+
+/*                    OPERAÇÕES DE INSERÇÃO E REMOÇÃO                    */
+
+/*
+Insere um dado com a prioridade dada.
+
+* h: ponteiro para o heap
+* dado: ponteiro para o dado
+* prioridade: chave do item (menor sai primeiro)
+
+Pré-condição: h deve ser válido
+Pós-condição: retorna o handle do item (>= 0), ou -1 em caso de falha
+*/
+int insereHeap(Heap h, void *dado, double prioridade);
+
+/*
+Remove o item de menor prioridade.
+
+* h: ponteiro para o heap
+* prioridade: recebe a prioridade do item removido (pode ser NULL)
+
+Pré-condição: h deve ser válido
+Pós-condição: retorna o dado removido, ou NULL se o heap está vazio
+*/
+void* removeMinimoHeap(Heap h, double *prioridade);
+
+/*
+Remove um item qualquer pelo seu handle.
+
+* h: ponteiro para o heap
+* handle: valor retornado por insereHeap
+
+Pré-condição: h deve ser válido
+Pós-condição: retorna o dado removido, ou NULL se o handle não está no heap
+*/
+void* removeHeap(Heap h, int handle);
+
+/*                    ALTERAÇÃO DE PRIORIDADE                    */
+
+/*
+Troca a prioridade de um item e o reposiciona (diminuir a prioridade
+é o "decrease-key"; aumentar também é permitido). Com compar, chamar
+também depois de alterar a chave do próprio dado, repassando a mesma
+prioridade.
+
+* h: ponteiro para o heap
+* handle: valor retornado por insereHeap
+* prioridade: nova prioridade
+
+Pré-condição: h deve ser válido
+Pós-condição: retorna false se o handle não está no heap
+*/
+bool alteraPrioridadeHeap(Heap h, int handle, double prioridade);
+
+/*                    OPERAÇÕES DE CONSULTA                    */
+
+/*
+Retorna o item de menor prioridade sem removê-lo.
+
+* h: ponteiro para o heap
+* prioridade: recebe a prioridade do item (pode ser NULL)
+
+Pré-condição: h deve ser válido
+Pós-condição: retorna o dado, ou NULL se o heap está vazio
+*/
+void* minimoHeap(Heap h, double *prioridade);
+
+/*
+Retorna a prioridade atual de um item.
+
+* h: ponteiro para o heap
+* handle: valor retornado por insereHeap
+* prioridade: recebe a prioridade
+
+Pré-condição: h e prioridade devem ser válidos
+Pós-condição: retorna false se o handle não está no heap
+*/
+bool getPrioridadeHeap(Heap h, int handle, double *prioridade);
+
+/*
+Verifica se o item de um handle ainda está no heap.
+
+Pré-condição: h deve ser válido
+Pós-condição: retorna true se está
+*/
+bool contemHeap(Heap h, int handle);
+
+/*
+Retorna o número de itens no heap.
+
+Pré-condição: h deve ser válido
+Pós-condição: retorna o tamanho (0 se h é NULL)
+*/
+int tamanhoHeap(Heap h);
+
+/*
+Verifica se o heap está vazio.
+
+Pré-condição: h deve ser válido
+Pós-condição: retorna true se vazio
+*/
+bool heapVazio(Heap h);
+
+#endif
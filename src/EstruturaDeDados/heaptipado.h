@@ -0,0 +1,145 @@
+#ifndef HEAPTIPADO_H
+#define HEAPTIPADO_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+*        HEAP TIPADO (GERADO POR MACRO)
+*
+*        HEAP_DEFINE(Nome, Tipo, MENOR, ARIDADE) gera um heap d-ário de
+*        mínimo que guarda valores de 'Tipo' diretamente no vetor (sem
+*        void* nem malloc por item) e compara com MENOR(a, b), que recebe
+*        dois 'const Tipo*' (como em sort_tipado.h) e deve ser verdadeira
+*        quando *a sai antes de *b. MENOR pode ser uma macro
+*        ou uma função static inline: como o código é gerado para cada
+*        tipo, a comparação é expandida no lugar, sem ponteiro de função.
+*
+*        Exemplo:
+*
+*            typedef struct { double dist; int id; } Vizinho;
+*            #define VIZINHO_MENOR(a, b) ((a)->dist < (b)->dist)
+*            HEAP_DEFINE(HeapVizinhos, Vizinho, VIZINHO_MENOR, 4)
+*
+*            HeapVizinhos h;
+*            HeapVizinhos_inicia(&h);
+*            HeapVizinhos_insere(&h, (Vizinho) { 2.5, 7 });
+*            Vizinho v = HeapVizinhos_remove(&h);
+*            HeapVizinhos_libera(&h);
+*
+*        Funções geradas (todas static inline, prefixo Nome_):
+*            inicia, libera, limpa, reserva, insere, topo, remove,
+*            tamanho, vazio.
+*
+*        Diferente de heap.h, o tipo gerado não é opaco (é declarado por
+*        valor, para poder ficar na pilha ou dentro de outra estrutura) e
+*        não tem handles: para alterar prioridades, usar heap.h.
+*/
+
+#define HEAP_DEFINE(Nome, Tipo, MENOR, ARIDADE)                                     \
+                                                                                    \
+typedef struct {                                                                    \
+    Tipo *itens;                                                                    \
+    int tamanho;                                                                    \
+    int capacidade;                                                                 \
+} Nome;                                                                             \
+                                                                                    \
+static inline void Nome##_inicia(Nome *h) {                                         \
+    h->itens = NULL;                                                                \
+    h->tamanho = 0;                                                                 \
+    h->capacidade = 0;                                                              \
+}                                                                                   \
+                                                                                    \
+static inline void Nome##_libera(Nome *h) {                                         \
+    free(h->itens);                                                                 \
+    Nome##_inicia(h);                                                               \
+}                                                                                   \
+                                                                                    \
+/* Esvazia mantendo a memória */                                                    \
+static inline void Nome##_limpa(Nome *h) {                                          \
+    h->tamanho = 0;                                                                 \
+}                                                                                   \
+                                                                                    \
+/* Garante espaço para 'n' itens; false se faltar memória */                        \
+static inline bool Nome##_reserva(Nome *h, int n) {                                 \
+    if (n <= h->capacidade) {                                                       \
+        return true;                                                                \
+    }                                                                               \
+    int novaCap = (h->capacidade > 0) ? h->capacidade : 16;                         \
+    while (novaCap < n) {                                                           \
+        novaCap *= 2;                                                               \
+    }                                                                               \
+    Tipo *novo = (Tipo*) realloc(h->itens, (size_t) novaCap * sizeof(Tipo));        \
+    if (novo == NULL) {                                                             \
+        fprintf(stderr, "Erro: falha ao aumentar o heap " #Nome ".\n");             \
+        return false;                                                               \
+    }                                                                               \
+    h->itens = novo;                                                                \
+    h->capacidade = novaCap;                                                        \
+    return true;                                                                    \
+}                                                                                   \
+                                                                                    \
+static inline bool Nome##_insere(Nome *h, Tipo valor) {                             \
+    if (!Nome##_reserva(h, h->tamanho + 1)) {                                       \
+        return false;                                                               \
+    }                                                                               \
+    int i = h->tamanho++;                                                           \
+    while (i > 0) {                                                                 \
+        int pai = (i - 1) / (ARIDADE);                                              \
+        if (!(MENOR(&valor, &h->itens[pai]))) {                                     \
+            break;                                                                  \
+        }                                                                           \
+        h->itens[i] = h->itens[pai];                                                \
+        i = pai;                                                                    \
+    }                                                                               \
+    h->itens[i] = valor;                                                            \
+    return true;                                                                    \
+}                                                                                   \
+                                                                                    \
+/* Pré-condição: heap não vazio */                                                  \
+static inline Tipo Nome##_topo(const Nome *h) {                                     \
+    return h->itens[0];                                                             \
+}                                                                                   \
+                                                                                    \
+/* Remove e retorna o menor. Pré-condição: heap não vazio */                        \
+static inline Tipo Nome##_remove(Nome *h) {                                         \
+    Tipo menor = h->itens[0];                                                       \
+    Tipo valor = h->itens[--h->tamanho];                                            \
+    int i = 0;                                                                      \
+    while (true) {                                                                  \
+        int primeiro = i * (ARIDADE) + 1;                                           \
+        if (primeiro >= h->tamanho) {                                               \
+            break;                                                                  \
+        }                                                                           \
+        int ultimo = primeiro + (ARIDADE);                                          \
+        if (ultimo > h->tamanho) {                                                  \
+            ultimo = h->tamanho;                                                    \
+        }                                                                           \
+        int m = primeiro;                                                           \
+        for (int f = primeiro + 1; f < ultimo; f++) {                               \
+            if (MENOR(&h->itens[f], &h->itens[m])) {                                \
+                m = f;                                                              \
+            }                                                                       \
+        }                                                                           \
+        if (!(MENOR(&h->itens[m], &valor))) {                                       \
+            break;                                                                  \
+        }                                                                           \
+        h->itens[i] = h->itens[m];                                                  \
+        i = m;                                                                      \
+    }                                                                               \
+    if (h->tamanho > 0) {                                                           \
+        h->itens[i] = valor;                                                        \
+    }                                                                               \
+    return menor;                                                                   \
+}                                                                                   \
+                                                                                    \
+static inline int Nome##_tamanho(const Nome *h) {                                   \
+    return h->tamanho;                                                              \
+}                                                                                   \
+                                                                                    \
+static inline bool Nome##_vazio(const Nome *h) {                                    \
+    return h->tamanho == 0;                                                         \
+}
+
+#endif
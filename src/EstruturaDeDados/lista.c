@@ -1,6 +1,7 @@
 #include "lista.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 typedef struct no {
     void *dado;
@@ -8,12 +9,249 @@ typedef struct no {
     struct no *anterior;
 } No;
 
+// Bloco de nós alocado de uma vez; os nós nunca são liberados um a um
+typedef struct blocoNos {
+    struct blocoNos *proximo;
+    int capacidade;
+    int usados;
+    No nos[];
+} BlocoNos;
+
+#define ELEMS_POR_BLOCO 32
+
+// Bloco da lista desenrolada: até ELEMS_POR_BLOCO elementos contíguos
+typedef struct blocoElems {
+    struct blocoElems *proximo;
+    struct blocoElems *anterior;
+    int qtd;
+    void *elems[ELEMS_POR_BLOCO];
+} BlocoElems;
+
 typedef struct lista {
     No *inicio;
     No *fim;
     int tamanho;
+    BlocoNos *blocos;   // o primeiro é o mais recente (de onde saem nós novos)
+    No *livres;         // nós removidos, encadeados por 'proximo'
+    int qtdLivres;
+    bool desenrolada;   // true: elementos em 'primeiro'..'ultimo', sem nós
+    BlocoElems *primeiro;
+    BlocoElems *ultimo;
 } ListaStruct;
 
+#define BLOCO_NOS_MIN 16
+#define BLOCO_NOS_MAX 4096
+
+/*                    ALOCAÇÃO DE NÓS                    */
+
+static bool novoBloco(ListaStruct *lista, int capacidade) {
+    BlocoNos *bloco = (BlocoNos*) malloc(sizeof(BlocoNos) + (size_t) capacidade * sizeof(No));
+    if (bloco == NULL) {
+        fprintf(stderr, "Erro: falha na alocação de nó da lista.\n");
+        return false;
+    }
+    bloco->capacidade = capacidade;
+    bloco->usados = 0;
+    bloco->proximo = lista->blocos;
+    lista->blocos = bloco;
+    return true;
+}
+
+// Nó reciclado, ou o próximo do bloco atual; sem nenhum, um bloco novo
+// com o dobro do anterior (entre BLOCO_NOS_MIN e BLOCO_NOS_MAX nós)
+static No* alocaNo(ListaStruct *lista) {
+    if (lista->livres != NULL) {
+        No *no = lista->livres;
+        lista->livres = no->proximo;
+        lista->qtdLivres--;
+        return no;
+    }
+
+    BlocoNos *bloco = lista->blocos;
+    if (bloco == NULL || bloco->usados == bloco->capacidade) {
+        int capacidade = (bloco == NULL) ? BLOCO_NOS_MIN : bloco->capacidade * 2;
+        if (capacidade > BLOCO_NOS_MAX) capacidade = BLOCO_NOS_MAX;
+        if (!novoBloco(lista, capacidade)) {
+            return NULL;
+        }
+        bloco = lista->blocos;
+    }
+    return &bloco->nos[bloco->usados++];
+}
+
+static void liberaNo(ListaStruct *lista, No *no) {
+    no->proximo = lista->livres;
+    lista->livres = no;
+    lista->qtdLivres++;
+}
+
+static void liberaBlocos(ListaStruct *lista) {
+    BlocoNos *bloco = lista->blocos;
+    while (bloco != NULL) {
+        BlocoNos *proximo = bloco->proximo;
+        free(bloco);
+        bloco = proximo;
+    }
+    lista->blocos = NULL;
+    lista->livres = NULL;
+    lista->qtdLivres = 0;
+}
+
+/*                    LISTA DESENROLADA                    */
+
+static BlocoElems* criaBlocoElems(ListaStruct *lista, BlocoElems *anterior) {
+    BlocoElems *bloco = (BlocoElems*) malloc(sizeof(BlocoElems));
+    if (bloco == NULL) {
+        fprintf(stderr, "Erro: falha na alocação de bloco da lista.\n");
+        return NULL;
+    }
+    bloco->qtd = 0;
+    bloco->anterior = anterior;
+    bloco->proximo = (anterior != NULL) ? anterior->proximo : lista->primeiro;
+    if (bloco->proximo != NULL) {
+        bloco->proximo->anterior = bloco;
+    } else {
+        lista->ultimo = bloco;
+    }
+    if (anterior != NULL) {
+        anterior->proximo = bloco;
+    } else {
+        lista->primeiro = bloco;
+    }
+    return bloco;
+}
+
+static void removeBlocoElems(ListaStruct *lista, BlocoElems *bloco) {
+    if (bloco->anterior != NULL) {
+        bloco->anterior->proximo = bloco->proximo;
+    } else {
+        lista->primeiro = bloco->proximo;
+    }
+    if (bloco->proximo != NULL) {
+        bloco->proximo->anterior = bloco->anterior;
+    } else {
+        lista->ultimo = bloco->anterior;
+    }
+    free(bloco);
+}
+
+// Bloco que contém a posição *pos (0 <= *pos < tamanho), percorrendo a
+// partir da ponta mais próxima; *pos passa a ser o índice dentro do bloco
+static BlocoElems* localizaBlocoElems(ListaStruct *lista, int *pos) {
+    if (*pos < lista->tamanho / 2) {
+        BlocoElems *bloco = lista->primeiro;
+        while (*pos >= bloco->qtd) {
+            *pos -= bloco->qtd;
+            bloco = bloco->proximo;
+        }
+        return bloco;
+    }
+
+    int resto = lista->tamanho - *pos;   // elementos a partir de pos
+    BlocoElems *bloco = lista->ultimo;
+    while (resto > bloco->qtd) {
+        resto -= bloco->qtd;
+        bloco = bloco->anterior;
+    }
+    *pos = bloco->qtd - resto;
+    return bloco;
+}
+
+static bool insereDesenrolada(ListaStruct *lista, void *dado, int pos) {
+    if (pos > lista->tamanho) pos = lista->tamanho;
+
+    BlocoElems *bloco;
+    int i = pos;
+    if (pos == lista->tamanho) {
+        // No fim, um bloco cheio não é dividido: abre-se outro depois dele,
+        // então inserções seguidas no fim deixam os blocos cheios
+        bloco = lista->ultimo;
+        if (bloco == NULL || bloco->qtd == ELEMS_POR_BLOCO) {
+            bloco = criaBlocoElems(lista, lista->ultimo);
+            if (bloco == NULL) return false;
+        }
+        i = bloco->qtd;
+    } else if (pos == 0 && lista->primeiro->qtd == ELEMS_POR_BLOCO) {
+        bloco = criaBlocoElems(lista, NULL);
+        if (bloco == NULL) return false;
+        i = 0;
+    } else {
+        bloco = localizaBlocoElems(lista, &i);
+        if (bloco->qtd == ELEMS_POR_BLOCO) {
+            // Divide ao meio; o elemento entra na metade que contém i
+            BlocoElems *novo = criaBlocoElems(lista, bloco);
+            if (novo == NULL) return false;
+            int metade = ELEMS_POR_BLOCO / 2;
+            memcpy(novo->elems, bloco->elems + metade, (ELEMS_POR_BLOCO - metade) * sizeof(void*));
+            novo->qtd = ELEMS_POR_BLOCO - metade;
+            bloco->qtd = metade;
+            if (i > metade) {
+                bloco = novo;
+                i -= metade;
+            }
+        }
+    }
+
+    memmove(bloco->elems + i + 1, bloco->elems + i, (bloco->qtd - i) * sizeof(void*));
+    bloco->elems[i] = dado;
+    bloco->qtd++;
+    lista->tamanho++;
+    return true;
+}
+
+static void* removeDesenrolada(ListaStruct *lista, int pos) {
+    if (pos < 0 || pos >= lista->tamanho) {
+        return NULL;
+    }
+
+    int i = pos;
+    BlocoElems *bloco = localizaBlocoElems(lista, &i);
+    void *dado = bloco->elems[i];
+    memmove(bloco->elems + i, bloco->elems + i + 1, (bloco->qtd - i - 1) * sizeof(void*));
+    bloco->qtd--;
+    lista->tamanho--;
+
+    // Bloco vazio sai; um bloco com o seguinte cabendo em meio bloco
+    // absorve o seguinte, para que remoções não deixem blocos esparsos
+    if (bloco->qtd == 0) {
+        removeBlocoElems(lista, bloco);
+    } else if (bloco->proximo != NULL && bloco->qtd + bloco->proximo->qtd <= ELEMS_POR_BLOCO / 2) {
+        BlocoElems *proximo = bloco->proximo;
+        memcpy(bloco->elems + bloco->qtd, proximo->elems, proximo->qtd * sizeof(void*));
+        bloco->qtd += proximo->qtd;
+        removeBlocoElems(lista, proximo);
+    }
+    return dado;
+}
+
+static void liberaBlocosElems(ListaStruct *lista, void (*destroiDado)(void*)) {
+    BlocoElems *bloco = lista->primeiro;
+    while (bloco != NULL) {
+        BlocoElems *proximo = bloco->proximo;
+        if (destroiDado != NULL) {
+            for (int i = 0; i < bloco->qtd; i++) {
+                destroiDado(bloco->elems[i]);
+            }
+        }
+        free(bloco);
+        bloco = proximo;
+    }
+}
+
+// Posição da primeira ocorrência de dado, ou -1
+static int posicaoDesenrolada(ListaStruct *lista, void *dado) {
+    int base = 0;
+    for (BlocoElems *bloco = lista->primeiro; bloco != NULL; bloco = bloco->proximo) {
+        for (int i = 0; i < bloco->qtd; i++) {
+            if (bloco->elems[i] == dado) {
+                return base + i;
+            }
+        }
+        base += bloco->qtd;
+    }
+    return -1;
+}
+
 /*                    FUNÇÕES DE CRIAÇÃO E DESTRUIÇÃO                    */
 
 Lista criaLista() {
@@ -26,24 +264,69 @@ Lista criaLista() {
     l->inicio = NULL;
     l->fim = NULL;
     l->tamanho = 0;
+    l->blocos = NULL;
+    l->livres = NULL;
+    l->qtdLivres = 0;
+    l->desenrolada = false;
+    l->primeiro = NULL;
+    l->ultimo = NULL;
     
     return (Lista) l;
 }
 
+Lista criaListaDesenrolada() {
+    ListaStruct *l = (ListaStruct*) criaLista();
+    if (l != NULL) {
+        l->desenrolada = true;
+    }
+    return (Lista) l;
+}
+
+Lista criaListaComCapacidade(int capacidade) {
+    Lista l = criaLista();
+    if (l != NULL && !reservaLista(l, capacidade)) {
+        destroiLista(l);
+        return NULL;
+    }
+    return l;
+}
+
+bool reservaLista(Lista l, int capacidade) {
+    if (l == NULL) {
+        return false;
+    }
+
+    ListaStruct *lista = (ListaStruct*) l;
+    if (lista->desenrolada) {
+        return true;    // blocos são criados conforme a lista cresce
+    }
+    int disponiveis = lista->qtdLivres;
+    if (lista->blocos != NULL) {
+        disponiveis += lista->blocos->capacidade - lista->blocos->usados;
+    }
+    int faltam = capacidade - lista->tamanho - disponiveis;
+    if (faltam <= 0) {
+        return true;
+    }
+
+    // O que sobrou do bloco atual vai para a lista de livres, já que o
+    // bloco novo passa a ser o atual
+    BlocoNos *atual = lista->blocos;
+    while (atual != NULL && atual->usados < atual->capacidade) {
+        liberaNo(lista, &atual->nos[atual->usados++]);
+    }
+    return novoBloco(lista, faltam < BLOCO_NOS_MIN ? BLOCO_NOS_MIN : faltam);
+}
+
 void destroiLista(Lista l) {
     if (l == NULL) {
         return;
     }
     
+    // Os nós vivem nos blocos: basta liberar os blocos
     ListaStruct *lista = (ListaStruct*) l;
-    No *atual = lista->inicio;
-    
-    while (atual != NULL) {
-        No *proximo = atual->proximo;
-        free(atual);
-        atual = proximo;
-    }
-    
+    liberaBlocos(lista);
+    liberaBlocosElems(lista, NULL);
     free(lista);
 }
 
@@ -53,15 +336,19 @@ void destroiListaCompleta(Lista l, void (*destroiDado)(void*)) {
     }
     
     ListaStruct *lista = (ListaStruct*) l;
+    if (lista->desenrolada) {
+        liberaBlocosElems(lista, destroiDado);
+        free(lista);
+        return;
+    }
     No *atual = lista->inicio;
     
     while (atual != NULL) {
-        No *proximo = atual->proximo;
         destroiDado(atual->dado);
-        free(atual);
-        atual = proximo;
+        atual = atual->proximo;
     }
     
+    liberaBlocos(lista);
     free(lista);
 }
 
@@ -73,10 +360,12 @@ bool insereListaInicio(Lista l, void *dado) {
     }
     
     ListaStruct *lista = (ListaStruct*) l;
-    No *novo = (No*) malloc(sizeof(No));
+    if (lista->desenrolada) {
+        return insereDesenrolada(lista, dado, 0);
+    }
+    No *novo = alocaNo(lista);
     
     if (novo == NULL) {
-        fprintf(stderr, "Erro: falha na alocação de nó da lista.\n");
         return false;
     }
     
@@ -102,10 +391,12 @@ bool insereListaFim(Lista l, void *dado) {
     }
     
     ListaStruct *lista = (ListaStruct*) l;
-    No *novo = (No*) malloc(sizeof(No));
+    if (lista->desenrolada) {
+        return insereDesenrolada(lista, dado, lista->tamanho);
+    }
+    No *novo = alocaNo(lista);
     
     if (novo == NULL) {
-        fprintf(stderr, "Erro: falha na alocação de nó da lista.\n");
         return false;
     }
     
@@ -131,6 +422,9 @@ bool insereListaPosicao(Lista l, void *dado, int pos) {
     }
     
     ListaStruct *lista = (ListaStruct*) l;
+    if (lista->desenrolada) {
+        return insereDesenrolada(lista, dado, pos);
+    }
     
     if (pos == 0) {
         return insereListaInicio(l, dado);
@@ -150,9 +444,8 @@ bool insereListaPosicao(Lista l, void *dado, int pos) {
         return false;
     }
     
-    No *novo = (No*) malloc(sizeof(No));
+    No *novo = alocaNo(lista);
     if (novo == NULL) {
-        fprintf(stderr, "Erro: falha na alocação de nó da lista.\n");
         return false;
     }
     
@@ -178,6 +471,9 @@ void* removeListaInicio(Lista l) {
     }
     
     ListaStruct *lista = (ListaStruct*) l;
+    if (lista->desenrolada) {
+        return removeDesenrolada(lista, 0);
+    }
     
     if (lista->inicio == NULL) {
         return NULL;
@@ -194,7 +490,7 @@ void* removeListaInicio(Lista l) {
         lista->fim = NULL;
     }
     
-    free(removido);
+    liberaNo(lista, removido);
     lista->tamanho--;
     
     return dado;
@@ -206,6 +502,9 @@ void* removeListaFim(Lista l) {
     }
     
     ListaStruct *lista = (ListaStruct*) l;
+    if (lista->desenrolada) {
+        return removeDesenrolada(lista, lista->tamanho - 1);
+    }
     
     if (lista->fim == NULL) {
         return NULL;
@@ -222,7 +521,7 @@ void* removeListaFim(Lista l) {
         lista->inicio = NULL;
     }
     
-    free(removido);
+    liberaNo(lista, removido);
     lista->tamanho--;
     
     return dado;
@@ -234,6 +533,9 @@ void* removeListaPosicao(Lista l, int pos) {
     }
     
     ListaStruct *lista = (ListaStruct*) l;
+    if (lista->desenrolada) {
+        return removeDesenrolada(lista, pos);
+    }
     
     if (pos == 0) {
         return removeListaInicio(l);
@@ -267,7 +569,7 @@ void* removeListaPosicao(Lista l, int pos) {
         lista->fim = atual->anterior;
     }
     
-    free(atual);
+    liberaNo(lista, atual);
     lista->tamanho--;
     
     return dado;
@@ -279,6 +581,14 @@ bool removeListaElemento(Lista l, void *dado) {
     }
     
     ListaStruct *lista = (ListaStruct*) l;
+    if (lista->desenrolada) {
+        int pos = posicaoDesenrolada(lista, dado);
+        if (pos < 0) {
+            return false;
+        }
+        removeDesenrolada(lista, pos);
+        return true;
+    }
     No *atual = lista->inicio;
     
     while (atual != NULL) {
@@ -295,7 +605,7 @@ bool removeListaElemento(Lista l, void *dado) {
                 lista->fim = atual->anterior;
             }
             
-            free(atual);
+            liberaNo(lista, atual);
             lista->tamanho--;
             return true;
         }
@@ -313,6 +623,13 @@ void* getListaPosicao(Lista l, int pos) {
     }
     
     ListaStruct *lista = (ListaStruct*) l;
+    if (lista->desenrolada) {
+        if (pos >= lista->tamanho) {
+            return NULL;
+        }
+        BlocoElems *bloco = localizaBlocoElems(lista, &pos);
+        return bloco->elems[pos];
+    }
     
     if (pos >= lista->tamanho) {
         return NULL;
@@ -333,6 +650,9 @@ void* getListaInicio(Lista l) {
     }
     
     ListaStruct *lista = (ListaStruct*) l;
+    if (lista->desenrolada) {
+        return (lista->primeiro != NULL) ? lista->primeiro->elems[0] : NULL;
+    }
     return (lista->inicio != NULL) ? lista->inicio->dado : NULL;
 }
 
@@ -342,6 +662,9 @@ void* getListaFim(Lista l) {
     }
     
     ListaStruct *lista = (ListaStruct*) l;
+    if (lista->desenrolada) {
+        return (lista->ultimo != NULL) ? lista->ultimo->elems[lista->ultimo->qtd - 1] : NULL;
+    }
     return (lista->fim != NULL) ? lista->fim->dado : NULL;
 }
 
@@ -369,6 +692,9 @@ bool buscaLista(Lista l, void *dado) {
     }
     
     ListaStruct *lista = (ListaStruct*) l;
+    if (lista->desenrolada) {
+        return posicaoDesenrolada(lista, dado) >= 0;
+    }
     No *atual = lista->inicio;
     
     while (atual != NULL) {
@@ -389,6 +715,14 @@ void percorreLista(Lista l, void (*funcao)(void*, void*), void *contexto) {
     }
     
     ListaStruct *lista = (ListaStruct*) l;
+    if (lista->desenrolada) {
+        for (BlocoElems *bloco = lista->primeiro; bloco != NULL; bloco = bloco->proximo) {
+            for (int i = 0; i < bloco->qtd; i++) {
+                funcao(bloco->elems[i], contexto);
+            }
+        }
+        return;
+    }
     No *atual = lista->inicio;
     
     while (atual != NULL) {
@@ -9,6 +9,18 @@
 *        Este módulo define uma lista genérica duplamente encadeada.
 *        A lista pode armazenar ponteiros para qualquer tipo de dado (void*).
 *        A representação interna é escondida por um ponteiro opaco.
+*
+*        Os nós de cada lista saem de blocos próprios dela (16, 32, ...
+*        até 4096 nós por bloco), e não de um malloc por inserção. Nós
+*        removidos voltam para uma lista de livres e são reaproveitados
+*        pelas próximas inserções; a memória dos blocos só é devolvida
+*        em destroiLista/destroiListaCompleta, de uma vez.
+*
+*        Uma lista criada com criaListaDesenrolada tem a mesma interface,
+*        mas guarda os elementos em blocos de até 32 ponteiros contíguos
+*        (lista desenrolada): getListaPosicao e as inserções/remoções no
+*        meio custam O(n/32) em vez de O(n), e percorrer a lista lê
+*        memória sequencial. Serve para listas acessadas por posição.
 */
 
 typedef void *Lista;
@@ -25,7 +37,40 @@ Pós-condição: retorna um ponteiro opaco para a lista criada,
 Lista criaLista();
 
 /*
-Libera toda a memória alocada pela lista.
+Cria uma lista vazia desenrolada (ver acima). Todas as funções deste
+módulo valem para ela; reservaLista não tem efeito.
+
+Pré-condição: nenhuma
+Pós-condição: retorna a lista criada, ou NULL em caso de falha
+*/
+Lista criaListaDesenrolada();
+
+/*
+Cria uma lista vazia com espaço para 'capacidade' elementos, que podem
+ser inseridos sem novas alocações.
+
+* capacidade: número de elementos previsto
+
+Pré-condição: nenhuma
+Pós-condição: retorna a lista criada, ou NULL em caso de falha
+*/
+Lista criaListaComCapacidade(int capacidade);
+
+/*
+Garante espaço para que a lista chegue a 'capacidade' elementos sem
+novas alocações (um único bloco cobre o que faltar).
+
+* l: ponteiro para a lista
+* capacidade: tamanho total previsto
+
+Pré-condição: l deve ser válido
+Pós-condição: retorna true se o espaço está disponível
+*/
+bool reservaLista(Lista l, int capacidade);
+
+/*
+Libera toda a memória alocada pela lista (os blocos de nós, sem
+percorrer os elementos).
 IMPORTANTE: Não libera os dados armazenados, apenas os nós da lista.
 Se você precisa liberar os dados, percorra a lista e libere cada elemento
 antes de chamar esta função.
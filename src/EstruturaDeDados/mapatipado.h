@@ -0,0 +1,182 @@
+#ifndef MAPATIPADO_H
+#define MAPATIPADO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+*        TABELA HASH TIPADA (GERADA POR MACRO)
+*
+*        MAPA_DEFINE(Nome, TipoChave, TipoValor, HASH, IGUAL) gera uma
+*        tabela hash de endereçamento aberto (sondagem linear) que guarda
+*        chave e valor por valor, num vetor só: uma busca típica lê uma ou
+*        duas linhas de cache, sem malloc por entrada nem ponteiro para o
+*        dado. HASH(k) recebe um 'const TipoChave*' e retorna uint32_t;
+*        IGUAL(a, b) recebe dois 'const TipoChave*'. As duas são expandidas
+*        no lugar (macro ou função static inline).
+*
+*            MAPA_DEFINE(MapaIdPos, int, int, MAPA_HASH_INT, MAPA_IGUAL_INT)
+*
+*            MapaIdPos m;
+*            MapaIdPos_inicia(&m);
+*            MapaIdPos_insere(&m, id, posicao);
+*            int *pos = MapaIdPos_busca(&m, id);     // NULL se não há
+*            MapaIdPos_libera(&m);
+*
+*        A capacidade é potência de 2 e a tabela cresce ao passar de 3/4
+*        de ocupação. A remoção desloca as entradas seguintes para trás
+*        (sem marcas de "apagado"), então a busca não degrada com o uso.
+*        Ponteiros retornados por busca valem até a próxima inserção ou
+*        remoção. Para percorrer: entradas[0..capacidade-1] com ocupada.
+*
+*        Funções geradas (static inline, prefixo Nome_):
+*            inicia, libera, limpa, reserva, insere, busca, remove, tamanho.
+*/
+
+// Mistura de bits (finalizador do MurmurHash3) para chaves inteiras
+static inline uint32_t mapaHashInt(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x85ebca6bu;
+    x ^= x >> 13;
+    x *= 0xc2b2ae35u;
+    x ^= x >> 16;
+    return x;
+}
+
+#define MAPA_HASH_INT(k) mapaHashInt((uint32_t) *(k))
+#define MAPA_IGUAL_INT(a, b) (*(a) == *(b))
+
+#define MAPA_DEFINE(Nome, TipoChave, TipoValor, HASH, IGUAL)                         \
+                                                                                     \
+typedef struct {                                                                     \
+    TipoChave chave;                                                                 \
+    TipoValor valor;                                                                 \
+    bool ocupada;                                                                    \
+} Nome##Entrada;                                                                     \
+                                                                                     \
+typedef struct {                                                                     \
+    Nome##Entrada *entradas;                                                         \
+    int tamanho;                                                                     \
+    int capacidade;     /* 0 ou potência de 2 */                                     \
+} Nome;                                                                              \
+                                                                                     \
+static inline void Nome##_inicia(Nome *m) {                                          \
+    m->entradas = NULL;                                                              \
+    m->tamanho = 0;                                                                  \
+    m->capacidade = 0;                                                               \
+}                                                                                    \
+                                                                                     \
+static inline void Nome##_libera(Nome *m) {                                          \
+    free(m->entradas);                                                               \
+    Nome##_inicia(m);                                                                \
+}                                                                                    \
+                                                                                     \
+/* Esvazia mantendo a memória */                                                     \
+static inline void Nome##_limpa(Nome *m) {                                           \
+    if (m->entradas != NULL) {                                                       \
+        memset(m->entradas, 0, (size_t) m->capacidade * sizeof(Nome##Entrada));      \
+    }                                                                                \
+    m->tamanho = 0;                                                                  \
+}                                                                                    \
+                                                                                     \
+/* Posição da chave, ou da vaga onde ela entraria */                                 \
+static inline int Nome##_posicao(const Nome *m, const TipoChave *chave) {            \
+    int mascara = m->capacidade - 1;                                                 \
+    int i = (int) (HASH(chave) & (uint32_t) mascara);                                \
+    while (m->entradas[i].ocupada && !(IGUAL(&m->entradas[i].chave, chave))) {       \
+        i = (i + 1) & mascara;                                                       \
+    }                                                                                \
+    return i;                                                                        \
+}                                                                                    \
+                                                                                     \
+/* Garante espaço para 'n' entradas sem passar de 3/4; false se faltar memória */    \
+static inline bool Nome##_reserva(Nome *m, int n) {                                  \
+    int novaCap = (m->capacidade > 0) ? m->capacidade : 16;                          \
+    while (n > novaCap / 4 * 3) {                                                    \
+        novaCap *= 2;                                                                \
+    }                                                                                \
+    if (novaCap == m->capacidade) {                                                  \
+        return true;                                                                 \
+    }                                                                                \
+    Nome##Entrada *novas = (Nome##Entrada*) calloc((size_t) novaCap,                 \
+                                                   sizeof(Nome##Entrada));           \
+    if (novas == NULL) {                                                             \
+        fprintf(stderr, "Erro: falha ao aumentar a tabela " #Nome ".\n");            \
+        return false;                                                                \
+    }                                                                                \
+    Nome antiga = *m;                                                                \
+    m->entradas = novas;                                                             \
+    m->capacidade = novaCap;                                                         \
+    for (int i = 0; i < antiga.capacidade; i++) {                                    \
+        if (antiga.entradas[i].ocupada) {                                            \
+            m->entradas[Nome##_posicao(m, &antiga.entradas[i].chave)] =              \
+                antiga.entradas[i];                                                  \
+        }                                                                            \
+    }                                                                                \
+    free(antiga.entradas);                                                           \
+    return true;                                                                     \
+}                                                                                    \
+                                                                                     \
+/* Insere ou substitui o valor da chave; false se faltar memória */                  \
+static inline bool Nome##_insere(Nome *m, TipoChave chave, TipoValor valor) {        \
+    if (!Nome##_reserva(m, m->tamanho + 1)) {                                        \
+        return false;                                                                \
+    }                                                                                \
+    Nome##Entrada *e = &m->entradas[Nome##_posicao(m, &chave)];                      \
+    if (!e->ocupada) {                                                               \
+        e->chave = chave;                                                            \
+        e->ocupada = true;                                                           \
+        m->tamanho++;                                                                \
+    }                                                                                \
+    e->valor = valor;                                                                \
+    return true;                                                                     \
+}                                                                                    \
+                                                                                     \
+/* Valor da chave (alterável no lugar), ou NULL se não está na tabela */             \
+static inline TipoValor* Nome##_busca(const Nome *m, TipoChave chave) {              \
+    if (m->tamanho == 0) {                                                           \
+        return NULL;                                                                 \
+    }                                                                                \
+    Nome##Entrada *e = &m->entradas[Nome##_posicao(m, &chave)];                      \
+    return e->ocupada ? &e->valor : NULL;                                            \
+}                                                                                    \
+                                                                                     \
+/* Remove a chave; false se ela não estava na tabela */                              \
+static inline bool Nome##_remove(Nome *m, TipoChave chave) {                         \
+    if (m->tamanho == 0) {                                                           \
+        return false;                                                                \
+    }                                                                                \
+    int mascara = m->capacidade - 1;                                                 \
+    int i = Nome##_posicao(m, &chave);                                               \
+    if (!m->entradas[i].ocupada) {                                                   \
+        return false;                                                                \
+    }                                                                                \
+    /* Puxa para a vaga as entradas seguintes da sequência cuja posição */           \
+    /* ideal não está entre a vaga e elas (senão a busca pararia antes) */           \
+    int j = i;                                                                       \
+    while (true) {                                                                   \
+        j = (j + 1) & mascara;                                                       \
+        if (!m->entradas[j].ocupada) {                                               \
+            break;                                                                   \
+        }                                                                            \
+        int ideal = (int) (HASH(&m->entradas[j].chave) & (uint32_t) mascara);        \
+        bool fica = (i <= j) ? (i < ideal && ideal <= j)                             \
+                             : (i < ideal || ideal <= j);                            \
+        if (!fica) {                                                                 \
+            m->entradas[i] = m->entradas[j];                                         \
+            i = j;                                                                   \
+        }                                                                            \
+    }                                                                                \
+    m->entradas[i].ocupada = false;                                                  \
+    m->tamanho--;                                                                    \
+    return true;                                                                     \
+}                                                                                    \
+                                                                                     \
+static inline int Nome##_tamanho(const Nome *m) {                                    \
+    return m->tamanho;                                                               \
+}
+
+#endif
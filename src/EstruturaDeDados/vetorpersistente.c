@@ -0,0 +1,238 @@
+#include "vetorpersistente.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BITS_NIVEL 5
+#define LARGURA_NO (1 << BITS_NIVEL)
+#define MASCARA_NO (LARGURA_NO - 1)
+
+// Nó interno (filhos são nós) ou folha (filhos são elementos)
+typedef struct noPersistente {
+    int refs;
+    void *filhos[LARGURA_NO];
+} NoPersistente;
+
+typedef struct {
+    NoPersistente *raiz;
+    int deslocamento;   // bits do índice abaixo da raiz (0: a raiz é folha)
+    int tamanho;
+    void (*retem)(void*);
+    void (*libera)(void*);
+} VetorPersistenteStruct;
+
+/*________________________________ FUNÇÕES AUXILIARES INTERNAS ________________________________*/
+
+static NoPersistente* criaNo() {
+    NoPersistente *no = (NoPersistente*) calloc(1, sizeof(NoPersistente));
+    if (no == NULL) {
+        fprintf(stderr, "Erro: falha na alocação de memória para nó do vetor persistente.\n");
+        return NULL;
+    }
+    no->refs = 1;
+    return no;
+}
+
+// Solta uma referência ao nó; o último a soltar libera a subárvore
+static void soltaNo(VetorPersistenteStruct *v, NoPersistente *no, int deslocamento) {
+    if (no == NULL || --no->refs > 0) {
+        return;
+    }
+    for (int i = 0; i < LARGURA_NO; i++) {
+        if (no->filhos[i] == NULL) continue;
+        if (deslocamento == 0) {
+            if (v->libera) v->libera(no->filhos[i]);
+        } else {
+            soltaNo(v, (NoPersistente*) no->filhos[i], deslocamento - BITS_NIVEL);
+        }
+    }
+    free(no);
+}
+
+/*
+ * Garante que *ref aponta para um nó exclusivo desta versão: cria o nó se
+ * não existe, ou copia se ele é compartilhado (os filhos da cópia ganham
+ * uma referência). Retorna o nó, ou NULL se faltou memória.
+ */
+static NoPersistente* exclusivo(VetorPersistenteStruct *v, NoPersistente **ref, int deslocamento) {
+    NoPersistente *no = *ref;
+    if (no != NULL && no->refs == 1) {
+        return no;
+    }
+
+    NoPersistente *novo = criaNo();
+    if (novo == NULL) {
+        return NULL;
+    }
+    if (no != NULL) {
+        memcpy(novo->filhos, no->filhos, sizeof(no->filhos));
+        for (int i = 0; i < LARGURA_NO; i++) {
+            if (novo->filhos[i] == NULL) continue;
+            if (deslocamento == 0) {
+                if (v->retem) v->retem(novo->filhos[i]);
+            } else {
+                ((NoPersistente*) novo->filhos[i])->refs++;
+            }
+        }
+        no->refs--;  // continua vivo: era compartilhado
+    }
+    *ref = novo;
+    return novo;
+}
+
+static void percorreNo(NoPersistente *no, int deslocamento, int base, void (*funcao)(void*, int, void*), void *contexto) {
+    if (no == NULL) {
+        return;
+    }
+    for (int i = 0; i < LARGURA_NO; i++) {
+        if (no->filhos[i] == NULL) continue;
+        int posicao = base | (i << deslocamento);
+        if (deslocamento == 0) {
+            funcao(no->filhos[i], posicao, contexto);
+        } else {
+            percorreNo((NoPersistente*) no->filhos[i], deslocamento - BITS_NIVEL, posicao, funcao, contexto);
+        }
+    }
+}
+
+static int contaCompartilhados(NoPersistente *no, int deslocamento, bool herdado) {
+    if (no == NULL) {
+        return 0;
+    }
+    bool compartilhado = herdado || no->refs > 1;
+    int total = compartilhado ? 1 : 0;
+    if (deslocamento > 0) {
+        for (int i = 0; i < LARGURA_NO; i++) {
+            total += contaCompartilhados((NoPersistente*) no->filhos[i], deslocamento - BITS_NIVEL, compartilhado);
+        }
+    }
+    return total;
+}
+
+/*________________________________ FUNÇÕES DE CRIAÇÃO E DESTRUIÇÃO ________________________________*/
+
+VetorPersistente criaVetorPersistente(void (*retem)(void*), void (*libera)(void*)) {
+    VetorPersistenteStruct *v = (VetorPersistenteStruct*) malloc(sizeof(VetorPersistenteStruct));
+    if (v == NULL) {
+        fprintf(stderr, "Erro: falha na alocação de memória para vetor persistente.\n");
+        return NULL;
+    }
+    v->raiz = NULL;
+    v->deslocamento = 0;
+    v->tamanho = 0;
+    v->retem = retem;
+    v->libera = libera;
+    return (VetorPersistente) v;
+}
+
+void destroiVetorPersistente(VetorPersistente v) {
+    if (v == NULL) {
+        return;
+    }
+    VetorPersistenteStruct *vetor = (VetorPersistenteStruct*) v;
+    soltaNo(vetor, vetor->raiz, vetor->deslocamento);
+    free(vetor);
+}
+
+VetorPersistente copiaVetorPersistente(VetorPersistente v) {
+    if (v == NULL) {
+        return NULL;
+    }
+    VetorPersistenteStruct *orig = (VetorPersistenteStruct*) v;
+    VetorPersistenteStruct *copia = (VetorPersistenteStruct*) malloc(sizeof(VetorPersistenteStruct));
+    if (copia == NULL) {
+        fprintf(stderr, "Erro: falha na alocação de memória para vetor persistente.\n");
+        return NULL;
+    }
+    *copia = *orig;
+    if (copia->raiz) copia->raiz->refs++;
+    return (VetorPersistente) copia;
+}
+
+/*________________________________ ACESSO E ALTERAÇÃO ________________________________*/
+
+void* getVetorPersistente(VetorPersistente v, int i) {
+    if (v == NULL || i < 0) {
+        return NULL;
+    }
+    VetorPersistenteStruct *vetor = (VetorPersistenteStruct*) v;
+    if (i >= vetor->tamanho) {
+        return NULL;
+    }
+
+    NoPersistente *no = vetor->raiz;
+    for (int d = vetor->deslocamento; d > 0 && no != NULL; d -= BITS_NIVEL) {
+        no = (NoPersistente*) no->filhos[(i >> d) & MASCARA_NO];
+    }
+    return (no != NULL) ? no->filhos[i & MASCARA_NO] : NULL;
+}
+
+bool setVetorPersistente(VetorPersistente v, int i, void *dado) {
+    if (v == NULL || i < 0) {
+        return false;
+    }
+    VetorPersistenteStruct *vetor = (VetorPersistenteStruct*) v;
+
+    // Cresce em altura até a posição caber (a raiz antiga vira o filho 0)
+    while (vetor->deslocamento < 30 && (i >> vetor->deslocamento) >= LARGURA_NO) {
+        if (vetor->raiz != NULL) {
+            NoPersistente *novaRaiz = criaNo();
+            if (novaRaiz == NULL) {
+                return false;
+            }
+            novaRaiz->filhos[0] = vetor->raiz;
+            vetor->raiz = novaRaiz;
+        }
+        vetor->deslocamento += BITS_NIVEL;
+    }
+
+    NoPersistente **ref = &vetor->raiz;
+    for (int d = vetor->deslocamento; d >= 0; d -= BITS_NIVEL) {
+        NoPersistente *no = exclusivo(vetor, ref, d);
+        if (no == NULL) {
+            return false;
+        }
+        if (d == 0) {
+            void **slot = &no->filhos[i & MASCARA_NO];
+            if (*slot != NULL && vetor->libera) vetor->libera(*slot);
+            *slot = dado;
+        } else {
+            ref = (NoPersistente**) &no->filhos[(i >> d) & MASCARA_NO];
+        }
+    }
+
+    if (i >= vetor->tamanho) {
+        vetor->tamanho = i + 1;
+    }
+    return true;
+}
+
+bool insereFimVetorPersistente(VetorPersistente v, void *dado) {
+    if (v == NULL) {
+        return false;
+    }
+    return setVetorPersistente(v, ((VetorPersistenteStruct*) v)->tamanho, dado);
+}
+
+int tamanhoVetorPersistente(VetorPersistente v) {
+    if (v == NULL) {
+        return 0;
+    }
+    return ((VetorPersistenteStruct*) v)->tamanho;
+}
+
+void percorreVetorPersistente(VetorPersistente v, void (*funcao)(void*, int, void*), void *contexto) {
+    if (v == NULL || funcao == NULL) {
+        return;
+    }
+    VetorPersistenteStruct *vetor = (VetorPersistenteStruct*) v;
+    percorreNo(vetor->raiz, vetor->deslocamento, 0, funcao, contexto);
+}
+
+int nosCompartilhadosVetorPersistente(VetorPersistente v) {
+    if (v == NULL) {
+        return 0;
+    }
+    VetorPersistenteStruct *vetor = (VetorPersistenteStruct*) v;
+    return contaCompartilhados(vetor->raiz, vetor->deslocamento, false);
+}
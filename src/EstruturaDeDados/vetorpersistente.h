@@ -0,0 +1,123 @@
+#ifndef VETORPERSISTENTE_H
+#define VETORPERSISTENTE_H
+
+#include <stdbool.h>
+
+/*
+*        TIPO ABSTRATO DE DADOS: VETOR PERSISTENTE
+*
+*        Vetor indexado (void*) guardado numa árvore de 32 filhos por nó
+*        (5 bits do índice por nível). Os nós têm contagem de referências
+*        e podem ser compartilhados entre várias versões do vetor:
+*
+*        - copiaVetorPersistente cria outra versão em O(1), compartilhando
+*          todos os nós;
+*        - uma alteração copia só os nós do caminho até a posição que
+*          ainda estejam compartilhados (no máximo 1 por nível); os nós
+*          exclusivos da versão são alterados no lugar, então alterações
+*          seguidas na mesma região não copiam de novo.
+*
+*        O acesso custa O(log32 n) (7 níveis cobrem 2^31 posições).
+*        Posições nunca escritas valem NULL, o que permite usar o vetor
+*        como mapa esparso de inteiros (ex.: id -> dado).
+*
+*        Os elementos também podem ser compartilhados entre versões: ao
+*        copiar uma folha, 'retem' é chamada para cada elemento dela, e ao
+*        liberar uma folha (ou sobrescrever uma posição), 'libera'. Com as
+*        duas NULL os elementos não têm dono.
+*
+*        Versões diferentes podem ser lidas em paralelo, mas a contagem de
+*        referências não é atômica: criar, alterar e destruir versões que
+*        compartilham nós deve ser feito por uma thread só.
+*/
+
+typedef void *VetorPersistente;
+
+/*                    FUNÇÕES DE CRIAÇÃO E DESTRUIÇÃO                    */
+
+/*
+Cria um vetor vazio.
+
+* retem: chamada quando um elemento passa a ser referenciado por mais uma
+  folha (ou NULL)
+* libera: chamada quando uma folha deixa de referenciar um elemento (ou NULL)
+
+Pré-condição: nenhuma
+Pós-condição: retorna o vetor, ou NULL em caso de falha
+*/
+VetorPersistente criaVetorPersistente(void (*retem)(void*), void (*libera)(void*));
+
+/*
+Libera esta versão. Os nós compartilhados com outras versões continuam
+vivos até a última delas ser destruída.
+
+* v: ponteiro para o vetor
+
+Pré-condição: v deve ser válido ou NULL
+Pós-condição: memória exclusiva desta versão liberada
+*/
+void destroiVetorPersistente(VetorPersistente v);
+
+/*
+Cria uma nova versão com o mesmo conteúdo, em O(1). Alterações em uma
+das versões não aparecem na outra.
+
+* v: ponteiro para o vetor
+
+Pré-condição: v deve ser válido
+Pós-condição: retorna a nova versão, ou NULL em caso de falha
+*/
+VetorPersistente copiaVetorPersistente(VetorPersistente v);
+
+/*                    ACESSO E ALTERAÇÃO                    */
+
+/*
+Retorna o elemento da posição i (NULL se nunca escrita ou i fora do vetor).
+*/
+void* getVetorPersistente(VetorPersistente v, int i);
+
+/*
+Escreve 'dado' na posição i, copiando os nós compartilhados do caminho.
+O elemento anterior da posição é entregue a 'libera'; 'dado' passa a
+pertencer ao vetor (não é chamada 'retem' para ele). Se i >= tamanho, o
+tamanho passa a ser i + 1 (as posições intermediárias valem NULL).
+
+* v: ponteiro para o vetor
+* i: posição (>= 0)
+* dado: elemento (pode ser NULL)
+
+Pré-condição: v deve ser válido
+Pós-condição: retorna true em caso de sucesso, false se faltou memória
+              (o vetor não é alterado)
+*/
+bool setVetorPersistente(VetorPersistente v, int i, void *dado);
+
+/*
+Escreve 'dado' na posição tamanho (ver setVetorPersistente).
+*/
+bool insereFimVetorPersistente(VetorPersistente v, void *dado);
+
+/*
+Retorna o tamanho (maior posição escrita + 1).
+*/
+int tamanhoVetorPersistente(VetorPersistente v);
+
+/*
+Aplica 'funcao' a cada elemento não NULL, em ordem de posição, em O(n).
+
+* v: ponteiro para o vetor
+* funcao: recebe o elemento, sua posição e o contexto
+* contexto: repassado a 'funcao'
+
+Pré-condição: v e funcao devem ser válidos
+Pós-condição: funcao aplicada; o vetor não deve ser alterado durante o percurso
+*/
+void percorreVetorPersistente(VetorPersistente v, void (*funcao)(void*, int, void*), void *contexto);
+
+/*
+Retorna quantos nós esta versão ainda compartilha com outras (para
+estatísticas e testes; percorre a árvore inteira).
+*/
+int nosCompartilhadosVetorPersistente(VetorPersistente v);
+
+#endif
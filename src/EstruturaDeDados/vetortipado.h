@@ -0,0 +1,98 @@
+#ifndef VETORTIPADO_H
+#define VETORTIPADO_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+*        VETOR DINÂMICO TIPADO (GERADO POR MACRO)
+*
+*        Lista e os demais TADs guardam void*: um par de doubles ou um
+*        evento vira um malloc à parte e um ponteiro a seguir. VEC_DEFINE
+*        gera um vetor que cresce (dobrando) e guarda os valores de 'Tipo'
+*        contíguos, por valor:
+*
+*            VEC_DEFINE(VetorEventos, Evento)
+*
+*            VetorEventos v;
+*            VetorEventos_inicia(&v);
+*            VetorEventos_insere(&v, (Evento) { ang, EV_INICIO, i });
+*            for (int i = 0; i < v.tamanho; i++) usa(&v.itens[i]);
+*            VetorEventos_libera(&v);
+*
+*        O tipo gerado não é opaco: itens e tamanho são lidos direto e
+*        'itens' pode ser passado a quem espera um Tipo* (ex.: sort tipado).
+*        O ponteiro muda quando o vetor cresce.
+*
+*        Funções geradas (static inline, prefixo Nome_):
+*            inicia, libera, limpa, reserva, insere, removeFim, tamanho, vazio.
+*        Deve ser usada em um .c (ou em um cabeçalho privado do módulo).
+*/
+
+#define VEC_DEFINE(Nome, Tipo)                                                       \
+                                                                                     \
+typedef struct {                                                                     \
+    Tipo *itens;                                                                     \
+    int tamanho;                                                                     \
+    int capacidade;                                                                  \
+} Nome;                                                                              \
+                                                                                     \
+static inline void Nome##_inicia(Nome *v) {                                          \
+    v->itens = NULL;                                                                 \
+    v->tamanho = 0;                                                                  \
+    v->capacidade = 0;                                                               \
+}                                                                                    \
+                                                                                     \
+static inline void Nome##_libera(Nome *v) {                                          \
+    free(v->itens);                                                                  \
+    Nome##_inicia(v);                                                                \
+}                                                                                    \
+                                                                                     \
+/* Esvazia mantendo a memória */                                                     \
+static inline void Nome##_limpa(Nome *v) {                                           \
+    v->tamanho = 0;                                                                  \
+}                                                                                    \
+                                                                                     \
+/* Garante espaço para 'n' itens; false se faltar memória */                         \
+static inline bool Nome##_reserva(Nome *v, int n) {                                  \
+    if (n <= v->capacidade) {                                                        \
+        return true;                                                                 \
+    }                                                                                \
+    int novaCap = (v->capacidade > 0) ? v->capacidade : 16;                          \
+    while (novaCap < n) {                                                            \
+        novaCap *= 2;                                                                \
+    }                                                                                \
+    Tipo *novo = (Tipo*) realloc(v->itens, (size_t) novaCap * sizeof(Tipo));         \
+    if (novo == NULL) {                                                              \
+        fprintf(stderr, "Erro: falha ao aumentar o vetor " #Nome ".\n");             \
+        return false;                                                                \
+    }                                                                                \
+    v->itens = novo;                                                                 \
+    v->capacidade = novaCap;                                                         \
+    return true;                                                                     \
+}                                                                                    \
+                                                                                     \
+/* Insere no fim; false (sem inserir) se faltar memória */                           \
+static inline bool Nome##_insere(Nome *v, Tipo valor) {                              \
+    if (v->tamanho == v->capacidade && !Nome##_reserva(v, v->tamanho + 1)) {         \
+        return false;                                                                \
+    }                                                                                \
+    v->itens[v->tamanho++] = valor;                                                  \
+    return true;                                                                     \
+}                                                                                    \
+                                                                                     \
+/* Remove e retorna o último. Pré-condição: vetor não vazio */                       \
+static inline Tipo Nome##_removeFim(Nome *v) {                                       \
+    return v->itens[--v->tamanho];                                                   \
+}                                                                                    \
+                                                                                     \
+static inline int Nome##_tamanho(const Nome *v) {                                    \
+    return v->tamanho;                                                               \
+}                                                                                    \
+                                                                                     \
+static inline bool Nome##_vazio(const Nome *v) {                                     \
+    return v->tamanho == 0;                                                          \
+}
+
+#endif
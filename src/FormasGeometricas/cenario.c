@@ -0,0 +1,265 @@
+#include "cenario.h"
+#include "vetorpersistente.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+// Forma guardada no cenário; 'refs' conta as folhas que apontam para ela
+typedef struct {
+    int refs;
+    bool emprestada;
+    Forma forma;
+} EntradaCenario;
+
+typedef struct {
+    VetorPersistente formas;    // posição -> EntradaCenario (NULL: removida)
+    VetorPersistente indice;    // id -> posição + 1
+    int qtd;
+    int copias;
+} CenarioStruct;
+
+/*________________________________ FUNÇÕES AUXILIARES INTERNAS ________________________________*/
+
+static EntradaCenario* criaEntrada(Forma f, bool emprestada) {
+    EntradaCenario *e = (EntradaCenario*) malloc(sizeof(EntradaCenario));
+    if (e == NULL) {
+        fprintf(stderr, "Erro: falha na alocação de memória para entrada do cenário.\n");
+        return NULL;
+    }
+    e->refs = 1;
+    e->emprestada = emprestada;
+    e->forma = f;
+    return e;
+}
+
+static void retemEntrada(void *dado) {
+    ((EntradaCenario*) dado)->refs++;
+}
+
+static void liberaEntrada(void *dado) {
+    EntradaCenario *e = (EntradaCenario*) dado;
+    if (--e->refs > 0) {
+        return;
+    }
+    if (!e->emprestada) {
+        destroiForma(e->forma);
+    }
+    free(e);
+}
+
+static void indexa(CenarioStruct *c, int id, int posicao) {
+    if (id >= 0) {
+        setVetorPersistente(c->indice, id, (void*) (intptr_t) (posicao + 1));
+    }
+}
+
+typedef struct {
+    Forma alvo;
+    int posicao;
+} BuscaPosicao;
+
+static void procuraForma(void *dado, int posicao, void *contexto) {
+    BuscaPosicao *b = (BuscaPosicao*) contexto;
+    if (b->posicao < 0 && ((EntradaCenario*) dado)->forma == b->alvo) {
+        b->posicao = posicao;
+    }
+}
+
+// Posição de f: pelo índice de ids, ou percorrendo (ids repetidos/negativos)
+static int posicaoForma(CenarioStruct *c, Forma f) {
+    int id = getFormaId(f);
+    if (id >= 0) {
+        int pos = (int) (intptr_t) getVetorPersistente(c->indice, id) - 1;
+        EntradaCenario *e = (EntradaCenario*) getVetorPersistente(c->formas, pos);
+        if (e != NULL && e->forma == f) {
+            return pos;
+        }
+    }
+
+    BuscaPosicao busca = { f, -1 };
+    percorreVetorPersistente(c->formas, procuraForma, &busca);
+    return busca.posicao;
+}
+
+static bool adicionaEntrada(CenarioStruct *c, Forma f, bool emprestada) {
+    EntradaCenario *e = criaEntrada(f, emprestada);
+    if (e == NULL) {
+        return false;
+    }
+    int posicao = tamanhoVetorPersistente(c->formas);
+    if (!setVetorPersistente(c->formas, posicao, e)) {
+        free(e);
+        return false;
+    }
+    indexa(c, getFormaId(f), posicao);
+    c->qtd++;
+    return true;
+}
+
+typedef struct {
+    CenarioStruct *cenario;
+    bool ok;
+} CargaLista;
+
+static void adicionaDaLista(void *dado, void *contexto) {
+    CargaLista *carga = (CargaLista*) contexto;
+    if (carga->ok && dado != NULL) {
+        carga->ok = adicionaEntrada(carga->cenario, (Forma) dado, true);
+    }
+}
+
+static void adicionaNaLista(void *dado, int posicao, void *contexto) {
+    (void) posicao;
+    insereListaFim((Lista) contexto, ((EntradaCenario*) dado)->forma);
+}
+
+/*________________________________ FUNÇÕES DE CRIAÇÃO E DESTRUIÇÃO ________________________________*/
+
+Cenario criaCenarioDeLista(Lista formas) {
+    CenarioStruct *c = (CenarioStruct*) malloc(sizeof(CenarioStruct));
+    if (c == NULL) {
+        fprintf(stderr, "Erro: falha na alocação de memória para cenário.\n");
+        return NULL;
+    }
+    c->formas = criaVetorPersistente(retemEntrada, liberaEntrada);
+    c->indice = criaVetorPersistente(NULL, NULL);
+    c->qtd = 0;
+    c->copias = 0;
+    if (c->formas == NULL || c->indice == NULL) {
+        destroiCenario(c);
+        return NULL;
+    }
+
+    CargaLista carga = { c, true };
+    percorreLista(formas, adicionaDaLista, &carga);
+    if (!carga.ok) {
+        destroiCenario(c);
+        return NULL;
+    }
+    return (Cenario) c;
+}
+
+Cenario copiaCenario(Cenario c) {
+    if (c == NULL) {
+        return NULL;
+    }
+    CenarioStruct *orig = (CenarioStruct*) c;
+    CenarioStruct *copia = (CenarioStruct*) malloc(sizeof(CenarioStruct));
+    if (copia == NULL) {
+        fprintf(stderr, "Erro: falha na alocação de memória para cenário.\n");
+        return NULL;
+    }
+    copia->formas = copiaVetorPersistente(orig->formas);
+    copia->indice = copiaVetorPersistente(orig->indice);
+    copia->qtd = orig->qtd;
+    copia->copias = 0;
+    if (copia->formas == NULL || copia->indice == NULL) {
+        destroiCenario(copia);
+        return NULL;
+    }
+    return (Cenario) copia;
+}
+
+void destroiCenario(Cenario c) {
+    if (c == NULL) {
+        return;
+    }
+    CenarioStruct *cenario = (CenarioStruct*) c;
+    destroiVetorPersistente(cenario->formas);
+    destroiVetorPersistente(cenario->indice);
+    free(cenario);
+}
+
+/*________________________________ CONSULTA ________________________________*/
+
+Lista listaFormasCenario(Cenario c) {
+    if (c == NULL) {
+        return NULL;
+    }
+    Lista vista = criaListaDesenrolada();
+    if (vista != NULL) {
+        percorreVetorPersistente(((CenarioStruct*) c)->formas, adicionaNaLista, vista);
+    }
+    return vista;
+}
+
+Forma buscaFormaIdCenario(Cenario c, int id) {
+    if (c == NULL || id < 0) {
+        return NULL;
+    }
+    CenarioStruct *cenario = (CenarioStruct*) c;
+    int pos = (int) (intptr_t) getVetorPersistente(cenario->indice, id) - 1;
+    EntradaCenario *e = (EntradaCenario*) getVetorPersistente(cenario->formas, pos);
+    return (e != NULL) ? e->forma : NULL;
+}
+
+int getQtdFormasCenario(Cenario c) {
+    return (c != NULL) ? ((CenarioStruct*) c)->qtd : 0;
+}
+
+int getQtdCopiasCenario(Cenario c) {
+    return (c != NULL) ? ((CenarioStruct*) c)->copias : 0;
+}
+
+/*________________________________ ALTERAÇÃO ________________________________*/
+
+Forma formaMutavelCenario(Cenario c, Forma f) {
+    if (c == NULL || f == NULL) {
+        return NULL;
+    }
+    CenarioStruct *cenario = (CenarioStruct*) c;
+    int pos = posicaoForma(cenario, f);
+    if (pos < 0) {
+        return NULL;
+    }
+
+    // Reescrever a entrada no lugar torna o caminho até ela exclusivo; se a
+    // folha era compartilhada, a entrada passa a ter mais de uma referência
+    EntradaCenario *e = (EntradaCenario*) getVetorPersistente(cenario->formas, pos);
+    retemEntrada(e);
+    if (!setVetorPersistente(cenario->formas, pos, e)) {
+        liberaEntrada(e);
+        return NULL;
+    }
+    if (e->refs == 1) {
+        return e->forma;
+    }
+
+    Forma copia = copiaForma(e->forma);
+    EntradaCenario *nova = (copia != NULL) ? criaEntrada(copia, false) : NULL;
+    if (nova == NULL) {
+        destroiForma(copia);
+        return NULL;
+    }
+    setVetorPersistente(cenario->formas, pos, nova);  // folha já exclusiva: não aloca
+    cenario->copias++;
+    return copia;
+}
+
+bool insereFormaCenario(Cenario c, Forma f) {
+    if (c == NULL || f == NULL) {
+        return false;
+    }
+    return adicionaEntrada((CenarioStruct*) c, f, false);
+}
+
+bool removeFormaCenario(Cenario c, Forma f) {
+    if (c == NULL || f == NULL) {
+        return false;
+    }
+    CenarioStruct *cenario = (CenarioStruct*) c;
+    int pos = posicaoForma(cenario, f);
+    if (pos < 0) {
+        return false;
+    }
+
+    int id = getFormaId(f);
+    if (!setVetorPersistente(cenario->formas, pos, NULL)) {
+        return false;
+    }
+    if (id >= 0 && (int) (intptr_t) getVetorPersistente(cenario->indice, id) == pos + 1) {
+        setVetorPersistente(cenario->indice, id, NULL);
+    }
+    cenario->qtd--;
+    return true;
+}
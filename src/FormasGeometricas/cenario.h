@@ -0,0 +1,128 @@
+#ifndef CENARIO_H
+#define CENARIO_H
+
+#include <stdbool.h>
+#include "formas.h"
+#include "lista.h"
+
+/*
+*        TIPO ABSTRATO DE DADOS: CENÁRIO PERSISTENTE
+*
+*        Coleção das formas do cenário com cópias baratas (instantâneos).
+*        Guarda as formas na ordem de inserção (a mesma da lista lida do
+*        .geo) e um índice id -> posição, os dois em vetores persistentes
+*        (ver vetorpersistente.h):
+*
+*        - copiaCenario cria um instantâneo em O(1);
+*        - a primeira alteração de uma forma depois de um instantâneo copia
+*          só aquela forma (copiaForma) e os nós do caminho até ela; as
+*          demais continuam compartilhadas;
+*        - remoções deixam a posição vazia, então a ordem das restantes
+*          não muda.
+*
+*        O cenário não tem índice espacial: as consultas de visibilidade
+*        percorrem a lista devolvida por listaFormasCenario.
+*
+*        Formas vindas de criaCenarioDeLista são emprestadas (continuam
+*        sendo do dono da lista e nunca são liberadas pelo cenário); as
+*        inseridas depois e as cópias feitas na escrita pertencem ao
+*        cenário e são liberadas quando a última versão que as usa some.
+*/
+
+typedef void *Cenario;
+
+/*                    FUNÇÕES DE CRIAÇÃO E DESTRUIÇÃO                    */
+
+/*
+Cria um cenário com as formas da lista, na mesma ordem.
+
+* formas: lista de Forma (as formas são emprestadas)
+
+Pré-condição: formas deve ser válida
+Pós-condição: retorna o cenário, ou NULL em caso de falha
+*/
+Cenario criaCenarioDeLista(Lista formas);
+
+/*
+Cria um instantâneo do cenário em O(1). As duas versões podem ser
+alteradas independentemente.
+
+Pré-condição: c deve ser válido
+Pós-condição: retorna a nova versão, ou NULL em caso de falha
+*/
+Cenario copiaCenario(Cenario c);
+
+/*
+Libera esta versão (e as formas que só ela usava).
+
+Pré-condição: c deve ser válido ou NULL
+Pós-condição: memória liberada
+*/
+void destroiCenario(Cenario c);
+
+/*                    CONSULTA                    */
+
+/*
+Retorna uma lista nova com as formas presentes, na ordem do cenário.
+A lista é só uma vista: liberar com destroiLista (sem liberar as formas).
+Ela não acompanha o cenário sozinha; para continuar usando-a, repetir
+nela cada alteração: remoção tira a posição da forma, inserção vai para
+o fim e formaMutavelCenario pode trocar a forma da posição pela cópia.
+É uma lista desenrolada, já que as consultas a percorrem por posição
+(getListaPosicao).
+
+Pré-condição: c deve ser válido
+Pós-condição: retorna a lista, ou NULL em caso de falha
+*/
+Lista listaFormasCenario(Cenario c);
+
+/*
+Retorna a forma com o id dado, ou NULL se não houver.
+A forma é só para leitura (ver formaMutavelCenario).
+*/
+Forma buscaFormaIdCenario(Cenario c, int id);
+
+/*
+Retorna o número de formas presentes.
+*/
+int getQtdFormasCenario(Cenario c);
+
+/*
+Retorna quantas formas esta versão já copiou por terem sido alteradas
+enquanto compartilhadas com outra versão.
+*/
+int getQtdCopiasCenario(Cenario c);
+
+/*                    ALTERAÇÃO                    */
+
+/*
+Prepara uma forma do cenário para ser alterada: se ela é compartilhada
+com outra versão, é trocada por uma cópia exclusiva desta.
+
+* c: cenário
+* f: forma presente em c (obtida da vista ou de buscaFormaIdCenario)
+
+Pré-condição: c e f devem ser válidos
+Pós-condição: retorna a forma que pode ser alterada (f ou sua cópia), ou
+              NULL se f não está no cenário
+*/
+Forma formaMutavelCenario(Cenario c, Forma f);
+
+/*
+Insere uma forma no fim do cenário; ela passa a pertencer ao cenário.
+
+Pré-condição: c e f devem ser válidos
+Pós-condição: retorna true em caso de sucesso
+*/
+bool insereFormaCenario(Cenario c, Forma f);
+
+/*
+Remove uma forma do cenário (liberada se não for emprestada nem usada
+por outra versão).
+
+Pré-condição: c e f devem ser válidos
+Pós-condição: retorna true se f estava no cenário
+*/
+bool removeFormaCenario(Cenario c, Forma f);
+
+#endif
@@ -1,4 +1,5 @@
 #include "circulo.h"
+#include "coordenada.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -7,16 +8,18 @@
 #define PI 3.14159265358979323846
 
 // estrutura interna do círculo
+// (ponteiros primeiro e campos pequenos juntos, para não sobrar
+// preenchimento nos modos de coordenadas compactas)
 typedef struct circulo {
-    int id;           // identificador único
-    double x;         // coordenada X do centro
-    double y;         // coordenada Y do centro
-    double r;         // raio
     char *corb;       // cor da borda
     char *corp;       // cor de preenchimento
-    double sw;        // largura do traço (stroke-width)
-    bool disp;        // flag de disparo
+    int id;           // identificador único
+    Coord x;          // coordenada X do centro
+    Coord y;          // coordenada Y do centro
+    Coord r;          // raio
+    Espessura sw;     // largura do traço (stroke-width)
     int n;            // identificador de seleção
+    bool disp;        // flag de disparo
 } circuloC;
 
 
@@ -35,9 +38,9 @@ Circulo criarCirculo(int i, double x, double y, double r, char *corb, char *corp
     }
     
     c->id = i;
-    c->x = x;
-    c->y = y;
-    c->r = r;
+    c->x = coordDeDouble(x);
+    c->y = coordDeDouble(y);
+    c->r = coordDeDouble(r);
     
     c->corb = (char*) malloc((strlen(corb) + 1) * sizeof(char));
     if (c->corb == NULL) {
@@ -73,6 +76,28 @@ void destroiCirculo(Circulo c) {
     free(circ);
 }
 
+Circulo copiaCirculo(const Circulo c) {
+    if (c == NULL) {
+        return NULL;
+    }
+    const circuloC *orig = (const circuloC*) c;
+    circuloC *novo = (circuloC*) malloc(sizeof(circuloC));
+    if (novo == NULL) {
+        printf("Erro: falha na alocação de memória.\n");
+        exit(1);
+    }
+    *novo = *orig;  // coordenadas copiadas sem reconversão
+    novo->corb = (char*) malloc(strlen(orig->corb) + 1);
+    novo->corp = (char*) malloc(strlen(orig->corp) + 1);
+    if (novo->corb == NULL || novo->corp == NULL) {
+        printf("Erro: falha na alocação de memória.\n");
+        exit(1);
+    }
+    strcpy(novo->corb, orig->corb);
+    strcpy(novo->corp, orig->corp);
+    return (Circulo) novo;
+}
+
 /*           MÉTODOS GET (CONSULTA)  */
 int getIdCirculo(const Circulo c) {
     if (c == NULL) {
@@ -83,17 +108,17 @@ int getIdCirculo(const Circulo c) {
 }
 double getXCirculo(Circulo c) {
     circuloC *circ = (circuloC*) c;
-    return circ->x;
+    return coordParaDouble(circ->x);
 }
 
 double getYCirculo(Circulo c) {
     circuloC *circ = (circuloC*) c;
-    return circ->y;
+    return coordParaDouble(circ->y);
 }
 
 double getRCirculo(Circulo c) {
     circuloC *circ = (circuloC*) c;
-    return circ->r;
+    return coordParaDouble(circ->r);
 }
 
 char* getCorbCirculo(Circulo c) {
@@ -125,12 +150,12 @@ int getNCirculo(Circulo c) {
 
 void setXCirculo(Circulo c, double x) {
     circuloC *circ = (circuloC*) c;
-    circ->x = x;
+    circ->x = coordDeDouble(x);
 }
 
 void setYCirculo(Circulo c, double y) {
     circuloC *circ = (circuloC*) c;
-    circ->y = y;
+    circ->y = coordDeDouble(y);
 }
 
 void setRCirculo(Circulo c, double r) {
@@ -139,7 +164,7 @@ void setRCirculo(Circulo c, double r) {
         return;
     }
     circuloC *circ = (circuloC*) c;
-    circ->r = r;
+    circ->r = coordDeDouble(r);
 }
 
 void setCorbCirculo(Circulo c,const char* corb) {
@@ -187,27 +212,27 @@ void setNCirculo(Circulo c, int n) {
 
 double calculaAreaCirculo(Circulo c) {
     circuloC *circ = (circuloC*) c;
-    return PI * circ->r * circ->r;
+    return PI * coordParaDouble(circ->r) * coordParaDouble(circ->r);
 }
 
 double calculaPerimetroCirculo(Circulo c) {
     circuloC *circ = (circuloC*) c;
-    return 2 * PI * circ->r;
+    return 2 * PI * coordParaDouble(circ->r);
 }
 
 bool pontoNoCirculo(Circulo c, double px, double py) {
     circuloC *circ = (circuloC*) c;
-    double distancia = sqrt(pow(px - circ->x, 2) + pow(py - circ->y, 2));
-    return distancia <= circ->r;
+    double distancia = sqrt(pow(px - coordParaDouble(circ->x), 2) + pow(py - coordParaDouble(circ->y), 2));
+    return distancia <= coordParaDouble(circ->r);
 }
 
 bool circulosIntersectam(Circulo c1, Circulo c2) {
     circuloC *circ1 = (circuloC*) c1;
     circuloC *circ2 = (circuloC*) c2;
     
-    double distanciaCentros = sqrt(pow(circ2->x - circ1->x, 2) + 
-                                   pow(circ2->y - circ1->y, 2));
-    double somaRaios = circ1->r + circ2->r;
+    double distanciaCentros = sqrt(pow(coordParaDouble(circ2->x) - coordParaDouble(circ1->x), 2) + 
+                                   pow(coordParaDouble(circ2->y) - coordParaDouble(circ1->y), 2));
+    double somaRaios = coordParaDouble(circ1->r) + coordParaDouble(circ2->r);
     
     return distanciaCentros <= somaRaios;
 }
@@ -220,7 +245,7 @@ void imprimeCirculoSVG(Circulo c, FILE *arquivo) {
     circuloC *circ = (circuloC *)c;
     
 fprintf(arquivo, "  <circle cx=\"%.2f\" cy=\"%.2f\" r=\"%.2f\" ",
-        circ->x, circ->y, circ->r);
+        coordParaDouble(circ->x), coordParaDouble(circ->y), coordParaDouble(circ->r));
 
 fprintf(arquivo, "stroke=\"%s\" fill=\"%s\" fill-opacity=\"0.5\" ",
         circ->corb, circ->corp);
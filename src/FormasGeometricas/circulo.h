@@ -55,6 +55,16 @@ Circulo criarCirculo(int i, double x, double y, double r, char *corb, char *corp
 */
 void destroiCirculo(Circulo c);
 
+/*
+ Cria uma cópia independente do círculo (mesmo id e atributos).
+
+ c : ponteiro para o círculo
+
+ Pré-condição : c deve ser válido
+ Pós-condição : retorna a cópia (liberar com destroiCirculo)
+*/
+Circulo copiaCirculo(const Circulo c);
+
 
 /*                                 MÉTODOS GET (CONSULTA)                                */
 /*
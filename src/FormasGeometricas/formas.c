@@ -74,6 +74,32 @@ void destroiForma(Forma f) {
     free(forma);
 }
 
+Forma copiaForma(const Forma f) {
+    if (!f) {
+        return NULL;
+    }
+
+    FormaInterno *forma = (FormaInterno*)f;
+    void *copia = NULL;
+
+    switch (forma->tipo) {
+        case TIPO_CIRCULO:
+            copia = copiaCirculo(forma->dados_especificos);
+            break;
+        case TIPO_RETANGULO:
+            copia = copiaRetangulo(forma->dados_especificos);
+            break;
+        case TIPO_LINHA:
+            copia = copiaLinha(forma->dados_especificos);
+            break;
+        case TIPO_TEXTO:
+            copia = copiaTexto(forma->dados_especificos);
+            break;
+    }
+
+    return criaForma(forma->id, forma->tipo, copia);
+}
+
 
 /*________________________________ FUNÇÕES DE CONSULTA (GETTERS) ________________________________*/
 
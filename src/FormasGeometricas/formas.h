@@ -55,6 +55,17 @@ específica contida nela.
 */
 void destroiForma(Forma f);
 
+/*
+Cria uma cópia independente da forma: mesmo ID, tipo e atributos, com os
+dados específicos também copiados (nada é compartilhado com o original).
+
+* f: A forma a ser copiada.
+*
+* Pré-condição: 'f' deve ser um ponteiro válido.
+* Pós-condição: Retorna a cópia (liberar com destroiForma), ou NULL em caso de falha.
+*/
+Forma copiaForma(const Forma f);
+
 
 /*________________________________ FUNÇÕES DE CONSULTA (GETTERS) ________________________________*/
 /*
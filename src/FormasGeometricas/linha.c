@@ -1,19 +1,21 @@
 #include "linha.h"
+#include "coordenada.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 
+// ponteiro primeiro e campos pequenos juntos (menos preenchimento)
 typedef struct linha {
-    int id;
-    double x1;
-    double y1;
-    double x2;
-    double y2;
     char *cor;
-    double sw;
-    bool disp;
+    int id;
+    Coord x1;
+    Coord y1;
+    Coord x2;
+    Coord y2;
+    Espessura sw;
     int n;
+    bool disp;
     bool pontilhada;
 } linhaC;
 
@@ -27,10 +29,10 @@ Linha criarLinha(int i, double x1, double y1, double x2, double y2, char *cor, b
     }
     
     l->id = i;
-    l->x1 = x1;
-    l->y1 = y1;
-    l->x2 = x2;
-    l->y2 = y2;
+    l->x1 = coordDeDouble(x1);
+    l->y1 = coordDeDouble(y1);
+    l->x2 = coordDeDouble(x2);
+    l->y2 = coordDeDouble(y2);
     
     l->cor = (char*) malloc((strlen(cor) + 1) * sizeof(char));
     if (l->cor == NULL) {
@@ -57,26 +59,46 @@ void destroiLinha(Linha l) {
     free(linha);
 }
 
+Linha copiaLinha(const Linha l) {
+    if (l == NULL) {
+        return NULL;
+    }
+    const linhaC *orig = (const linhaC*) l;
+    linhaC *novo = (linhaC*) malloc(sizeof(linhaC));
+    if (novo == NULL) {
+        printf("Erro: falha na alocação de memória.\n");
+        exit(1);
+    }
+    *novo = *orig;  // coordenadas copiadas sem reconversão
+    novo->cor = (char*) malloc(strlen(orig->cor) + 1);
+    if (novo->cor == NULL) {
+        printf("Erro: falha na alocação de memória.\n");
+        exit(1);
+    }
+    strcpy(novo->cor, orig->cor);
+    return (Linha) novo;
+}
+
 /*                                MÉTODOS GET                                */
 
 double getX1Linha(Linha l) {
     linhaC *linha = (linhaC*) l;
-    return linha->x1;
+    return coordParaDouble(linha->x1);
 }
 
 double getY1Linha(Linha l) {
     linhaC *linha = (linhaC*) l;
-    return linha->y1;
+    return coordParaDouble(linha->y1);
 }
 
 double getX2Linha(Linha l) {
     linhaC *linha = (linhaC*) l;
-    return linha->x2;
+    return coordParaDouble(linha->x2);
 }
 
 double getY2Linha(Linha l) {
     linhaC *linha = (linhaC*) l;
-    return linha->y2;
+    return coordParaDouble(linha->y2);
 }
 
 char* getCorLinha(Linha l) {
@@ -106,22 +128,22 @@ int getNLinha(Linha l) {
 /*                                MÉTODOS SET                                */ 
 void setX1Linha(Linha l, double x) {
     linhaC *linha = (linhaC*) l;
-    linha->x1 = x;
+    linha->x1 = coordDeDouble(x);
 }
 
 void setY1Linha(Linha l, double y) {
     linhaC *linha = (linhaC*) l;
-    linha->y1 = y;
+    linha->y1 = coordDeDouble(y);
 }
 
 void setX2Linha(Linha l, double x) {
     linhaC *linha = (linhaC*) l;
-    linha->x2 = x;
+    linha->x2 = coordDeDouble(x);
 }
 
 void setY2Linha(Linha l, double y) {
     linhaC *linha = (linhaC*) l;
-    linha->y2 = y;
+    linha->y2 = coordDeDouble(y);
 }
 
 void setCorLinha(Linha l, const char* cor) {
@@ -164,8 +186,8 @@ void setPontilhadaLinha(Linha l, bool pontilhada) {
 
 double calculaComprimentoLinha(Linha l) {
     linhaC *linha = (linhaC*) l;
-    double dx = linha->x2 - linha->x1;
-    double dy = linha->y2 - linha->y1;
+    double dx = coordParaDouble(linha->x2) - coordParaDouble(linha->x1);
+    double dy = coordParaDouble(linha->y2) - coordParaDouble(linha->y1);
     return sqrt(dx * dx + dy * dy);
 }
 
@@ -184,7 +206,7 @@ void imprimeLinhaSVG(Linha l, FILE *arquivo) {
 
     //imprime a tag <line> no arquivo SVG
     fprintf(arquivo, "\t<line x1=\"%.2f\" y1=\"%.2f\" x2=\"%.2f\" y2=\"%.2f\" stroke=\"%s\" stroke-width=\"%.2f\"",
-            linha->x1, linha->y1, linha->x2, linha->y2, linha->cor, linha->sw);
+            coordParaDouble(linha->x1), coordParaDouble(linha->y1), coordParaDouble(linha->x2), coordParaDouble(linha->y2), linha->cor, linha->sw);
     
     //adiciona pontilhado se precisar
     if (linha->pontilhada) {
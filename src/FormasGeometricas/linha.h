@@ -54,6 +54,16 @@ Linha criarLinha(int i, double x1, double y1, double x2, double y2, char *cor, b
 */
 void destroiLinha(Linha l);
 
+/*
+Cria uma cópia independente da linha (mesmo id e atributos).
+
+l: ponteiro para a linha
+
+Pré-condição: l deve ser válido
+Pós-condição: retorna a cópia (liberar com destroiLinha)
+*/
+Linha copiaLinha(const Linha l);
+
 
 /*              MÉTODOS GET (CONSULTA) */
 /*
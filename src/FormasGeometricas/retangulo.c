@@ -1,20 +1,22 @@
 #include "retangulo.h"
+#include "coordenada.h"
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+//ponteiros primeiro e campos pequenos juntos (menos preenchimento)
 typedef struct retangulo{
-    int id; //identificador
-    double x;
-    double y;
-    double w; //deve ser >0
-    double h; //deve ser >0
     char *corb;
     char *corp;
-    double sw; //largura do traco
-    bool disp;
+    int id; //identificador
+    Coord x;
+    Coord y;
+    Coord w; //deve ser >0
+    Coord h; //deve ser >0
+    Espessura sw; //largura do traco
     int n; 
+    bool disp;
 
 }retanguloR; //retanguloR != Retangulo
 
@@ -32,10 +34,10 @@ Retangulo criarRetangulo(int i, double x, double y, double w, double h, char *co
 
 //atribuir
     r->id= i;
-    r->x = x;
-    r->y = y;
-    r->w = w;
-    r->h = h;
+    r->x = coordDeDouble(x);
+    r->y = coordDeDouble(y);
+    r->w = coordDeDouble(w);
+    r->h = coordDeDouble(h);
 
     //cor borda 
     r->corb = (char*)malloc((strlen(corb) + 1) * sizeof(char));
@@ -77,25 +79,47 @@ void destroiRetangulo(Retangulo r) {
     free(ret);
 }
 
+Retangulo copiaRetangulo(const Retangulo r){
+    if(r == NULL){
+        return NULL;
+    }
+    const retanguloR *orig = (const retanguloR*) r;
+    retanguloR *novo = (retanguloR*) malloc(sizeof(retanguloR));
+    if(novo == NULL){
+        printf("Erro: falha na alocacao de memoria.\n");
+        exit(1);
+    }
+    *novo = *orig; //coordenadas copiadas sem reconversao
+    novo->corb = (char*) malloc(strlen(orig->corb) + 1);
+    novo->corp = (char*) malloc(strlen(orig->corp) + 1);
+    if(novo->corb == NULL || novo->corp == NULL){
+        printf("Erro: falha na alocacao de memoria.\n");
+        exit(1);
+    }
+    strcpy(novo->corb, orig->corb);
+    strcpy(novo->corp, orig->corp);
+    return (Retangulo) novo;
+}
+
 
 double getXRetangulo(Retangulo r) {
     retanguloR *ret = (retanguloR*) r;
-    return ret->x;
+    return coordParaDouble(ret->x);
 }
 
 double getYRetangulo(Retangulo r) {
     retanguloR *ret = (retanguloR*) r;
-    return ret->y;
+    return coordParaDouble(ret->y);
 }
 
 double getLarguraRetangulo(Retangulo r) {
     retanguloR *ret = (retanguloR*) r;
-    return ret->w;
+    return coordParaDouble(ret->w);
 }
 
 double getAlturaRetangulo(Retangulo r) {
     retanguloR *ret = (retanguloR*) r;
-    return ret->h;
+    return coordParaDouble(ret->h);
 }
 
 char* getCorbRetangulo(Retangulo r) {
@@ -127,12 +151,12 @@ int getNRetangulo(Retangulo r) {
     //mas esses com validacao pra mais certeza
 void setXRetangulo(Retangulo r, double x) {
     retanguloR *ret = (retanguloR*) r;
-    ret->x = x;
+    ret->x = coordDeDouble(x);
 }
 
 void setYRetangulo(Retangulo r, double y) {
     retanguloR *ret = (retanguloR*) r;
-    ret->y = y;
+    ret->y = coordDeDouble(y);
 }
 
 void setLarguraRetangulo(Retangulo r, double w) {
@@ -141,7 +165,7 @@ void setLarguraRetangulo(Retangulo r, double w) {
         return;
     }
     retanguloR *ret = (retanguloR*) r;
-    ret->w = w;
+    ret->w = coordDeDouble(w);
 }
 
 void setAlturaRetangulo(Retangulo r, double h) {
@@ -150,7 +174,7 @@ void setAlturaRetangulo(Retangulo r, double h) {
         return;
     }
     retanguloR *ret = (retanguloR*) r;
-    ret->h = h;
+    ret->h = coordDeDouble(h);
 }
 
 //mais complexos - alocar dinamicamente
@@ -200,18 +224,18 @@ void setNRetangulo(Retangulo r, int n) {
 //gemometria
 double calculaAreaRetangulo(Retangulo r) {
     retanguloR *ret = (retanguloR*) r;
-    return ret->w * ret->h;
+    return coordParaDouble(ret->w) * coordParaDouble(ret->h);
 }
 
 double calculaPerimetroRetangulo(Retangulo r) {
     retanguloR *ret = (retanguloR*) r;
-    return 2 * (ret->w + ret->h);
+    return 2 * (coordParaDouble(ret->w) + coordParaDouble(ret->h));
 }
 
 bool pontoNoRetangulo(Retangulo r, double px, double py) {
     retanguloR *ret = (retanguloR*) r;
-    return (px >= ret->x && px <= ret->x + ret->w &&
-            py >= ret->y && py <= ret->y + ret->h);
+    return (px >= coordParaDouble(ret->x) && px <= coordParaDouble(ret->x) + coordParaDouble(ret->w) &&
+            py >= coordParaDouble(ret->y) && py <= coordParaDouble(ret->y) + coordParaDouble(ret->h));
 }
 
 bool retangulosIntersectam(Retangulo r1, Retangulo r2) {
@@ -238,10 +262,10 @@ void imprimeRetanguloSVG(Retangulo r, FILE *arquivo) {
 
     retanguloR *ret = (retanguloR*) r;
 fprintf(arquivo, "\t<rect x=\"%.2f\" y=\"%.2f\" width=\"%.2f\" height=\"%.2f\" fill=\"%s\" fill-opacity=\"0.5\" stroke=\"%s\" stroke-width=\"%.2f\" />\n",
-        ret->x,
-        ret->y,
-        ret->w,
-        ret->h,
+        coordParaDouble(ret->x),
+        coordParaDouble(ret->y),
+        coordParaDouble(ret->w),
+        coordParaDouble(ret->h),
         ret->corp,  
         ret->corb,  
         ret->sw);
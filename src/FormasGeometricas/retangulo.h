@@ -56,6 +56,16 @@ Retangulo criarRetangulo(int i, double x, double y, double w, double h, char *co
 */
 void destroiRetangulo(Retangulo r);
 
+/*
+Cria uma cópia independente do retângulo (mesmo id e atributos).
+
+r: ponteiro para o retângulo
+
+Pré-condição: r deve ser válido
+Pós-condição: retorna a cópia (liberar com destroiRetangulo)
+*/
+Retangulo copiaRetangulo(const Retangulo r);
+
 
 /*                     MÉTODOS GET (CONSULTA)  */
 /*
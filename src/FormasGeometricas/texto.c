@@ -1,4 +1,5 @@
 #include "texto.h"
+#include "coordenada.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -11,7 +12,7 @@ typedef struct stEstilo {
 
 typedef struct stTexto {
     int i;
-    double x, y;
+    Coord x, y;
     char *corb, *corp;
     char a;  // âncora: 'i', 'm', 'f'
     char *txto;
@@ -172,8 +173,8 @@ Texto criarTexto(int i, double x, double y, const char *corb, const char *corp,
     }
     
     t->i = i;
-    t->x = x;
-    t->y = y;
+    t->x = coordDeDouble(x);
+    t->y = coordDeDouble(y);
     t->a = a;
     
     t->corb = (char *)malloc(strlen(corb) + 1);
@@ -211,6 +212,32 @@ void destroiTexto(Texto t) {
     free(txt);
 }
 
+Texto copiaTexto(const Texto t) {
+    if (t == NULL) return NULL;
+
+    const Texto_t *orig = (const Texto_t *)t;
+    Texto_t *novo = (Texto_t *)malloc(sizeof(Texto_t));
+    if (novo == NULL) {
+        fprintf(stderr, "Erro ao alocar memoria para a stTexto!\n");
+        exit(1);
+    }
+    *novo = *orig;  // coordenadas copiadas sem reconversão
+
+    novo->corb = (char *)malloc(strlen(orig->corb) + 1);
+    novo->corp = (char *)malloc(strlen(orig->corp) + 1);
+    novo->txto = (char *)malloc(strlen(orig->txto) + 1);
+    if (novo->corb == NULL || novo->corp == NULL || novo->txto == NULL) {
+        fprintf(stderr, "Erro ao alocar memoria para os campos do texto!\n");
+        exit(1);
+    }
+    strcpy(novo->corb, orig->corb);
+    strcpy(novo->corp, orig->corp);
+    strcpy(novo->txto, orig->txto);
+    novo->e = criaCopiaEstilo(orig->e);
+
+    return (Texto)novo;
+}
+
 int getIdTexto(const Texto t) {
     if (t == NULL) return -1;
     return ((Texto_t *)t)->i;
@@ -218,12 +245,12 @@ int getIdTexto(const Texto t) {
 
 double getXTexto(const Texto t) {
     if (t == NULL) return 0.0;
-    return ((Texto_t *)t)->x;
+    return coordParaDouble(((Texto_t *)t)->x);
 }
 
 double getYTexto(const Texto t) {
     if (t == NULL) return 0.0;
-    return ((Texto_t *)t)->y;
+    return coordParaDouble(((Texto_t *)t)->y);
 }
 
 char* getCorbTexto(const Texto t) {
@@ -255,12 +282,12 @@ Estilo getEstiloTexto(const Texto t) {
 
 void setXTexto(Texto t, double x) {
     if (t == NULL) return;
-    ((Texto_t *)t)->x = x;
+    ((Texto_t *)t)->x = coordDeDouble(x);
 }
 
 void setYTexto(Texto t, double y) {
     if (t == NULL) return;
-    ((Texto_t *)t)->y = y;
+    ((Texto_t *)t)->y = coordDeDouble(y);
 }
 
 void setCorbTexto(Texto t, const char *corb) {
@@ -333,7 +360,7 @@ void imprimeTextoSVG(const Texto t, FILE *arquivo) {
     }
     
     fprintf(arquivo, "\t<text x=\"%.2f\" y=\"%.2f\" fill=\"%s\" stroke=\"%s\" text-anchor=\"%s\"",
-            txt->x, txt->y, txt->corp, txt->corb, text_anchor);
+            coordParaDouble(txt->x), coordParaDouble(txt->y), txt->corp, txt->corb, text_anchor);
     
     if (est != NULL) {
         fprintf(arquivo, " font-family=\"%s\" font-weight=\"%s\" font-size=\"%s\"",
@@ -351,7 +378,7 @@ void imprimeTextoTXT(const Texto t, FILE *arquivo) {
     Estilo_t *est = txt->e;
     
     fprintf(arquivo, "Texto ID: %d\n", txt->i);
-    fprintf(arquivo, "  Posição: (%.2f, %.2f)\n", txt->x, txt->y);
+    fprintf(arquivo, "  Posição: (%.2f, %.2f)\n", coordParaDouble(txt->x), coordParaDouble(txt->y));
     fprintf(arquivo, "  Cor borda: %s\n", txt->corb);
     fprintf(arquivo, "  Cor preenchimento: %s\n", txt->corp);
     fprintf(arquivo, "  Âncora: %c\n", txt->a);
@@ -124,6 +124,16 @@ interna do seu estilo.
 */
 void destroiTexto(Texto t);
 
+/*
+Cria uma cópia independente do texto (mesmo id, atributos e estilo).
+
+t: ponteiro para o texto
+
+Pré-condição: t deve ser válido
+Pós-condição: retorna a cópia (liberar com destroiTexto)
+*/
+Texto copiaTexto(const Texto t);
+
 
 /*                                              MÉTODOS GET (CONSULTA)                                                   */
 
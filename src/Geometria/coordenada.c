@@ -0,0 +1,69 @@
+#include "coordenada.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+static double erroMaximo = 0.0;
+
+#if defined(COORD_FIXA) || defined(COORD_FLOAT)
+static void registraErro(double original, double guardado) {
+    double erro = fabs(original - guardado);
+    if (erro > erroMaximo) erroMaximo = erro;
+}
+#endif
+
+double erroMaximoCoord(void) {
+    return erroMaximo;
+}
+
+#ifdef COORD_FIXA
+
+// Avisos só na primeira ocorrência, para não inundar a saída
+static bool avisouArredondamento = false;
+static bool avisouSaturacao = false;
+
+Coord coordDeDouble(double v) {
+    double original = v;   // o erro é medido contra o valor pedido, antes da saturação
+    if (fabs(v) >= COORD_MAX_ABS) {
+        if (!avisouSaturacao) {
+            fprintf(stderr, "Aviso: coordenada %g fora do alcance do ponto fixo; saturada.\n", v);
+            avisouSaturacao = true;
+        }
+        v = (v > 0) ? COORD_MAX_ABS - 1.0 / ESCALA_COORD : -COORD_MAX_ABS + 1.0 / ESCALA_COORD;
+    }
+
+    double escalado = v * ESCALA_COORD;
+    double arredondado = nearbyint(escalado);
+    if (!avisouArredondamento && fabs(escalado - arredondado) > 1e-6 * fmax(1.0, fabs(escalado))) {
+        fprintf(stderr, "Aviso: coordenada %g arredondada para %d casas decimais.\n", v,
+                (int) lround(log10(ESCALA_COORD)));
+        avisouArredondamento = true;
+    }
+    registraErro(original, arredondado / ESCALA_COORD);
+    return (Coord) arredondado;
+}
+
+const char* descricaoCoord(void) {
+    return "ponto fixo int32 (centesimos, 4 bytes)";
+}
+
+#elif defined(COORD_FLOAT)
+
+Coord coordDeDouble(double v) {
+    Coord c = (Coord) v;
+    registraErro(v, (double) c);
+    return c;
+}
+
+const char* descricaoCoord(void) {
+    return "float (4 bytes)";
+}
+
+#else
+
+const char* descricaoCoord(void) {
+    return "double (8 bytes)";
+}
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef COORDENADA_H
+#define COORDENADA_H
+
+#include <stdint.h>
+
+/*
+*        MÓDULO DE REPRESENTAÇÃO DE COORDENADAS
+*
+*        Define como as formas e os pontos guardam suas coordenadas.
+*        A escolha é feita na compilação:
+*
+*        - padrão: double (8 bytes por coordenada);
+*        - COORD_FIXA (make COORD=fixa): inteiro de 32 bits em centésimos
+*          (ESCALA_COORD), suficiente para as coordenadas das cidades,
+*          que têm no máximo duas casas decimais. Ocupa metade da memória
+*          e permite testes de orientação exatos em inteiros de 64 bits
+*          (ver sinalOrientCoord em predicados.h);
+*        - COORD_FLOAT (make COORD=float): float de 32 bits. Também ocupa
+*          metade, sem limite de casas decimais, mas com ~7 dígitos
+*          significativos; os predicados continuam em double sobre os
+*          valores já arredondados.
+*
+*        A interface das formas continua em double: os getters convertem
+*        com coordParaDouble e os construtores/setters com coordDeDouble.
+*        Em ponto fixo, valores com mais casas decimais são arredondados
+*        para a grade (com um aviso) e |valor| deve ficar abaixo de
+*        COORD_MAX_ABS, para que os determinantes caibam em 64 bits.
+*
+*        Nos dois modos compactos a espessura do traço (Espessura) também
+*        é guardada em float.
+*/
+
+#ifdef COORD_FIXA
+
+typedef int32_t Coord;
+
+#define ESCALA_COORD 100
+#define COORD_MAX_ABS ((double) (1L << 30) / ESCALA_COORD)
+
+/*
+Converte um valor para a grade de ponto fixo (arredondando).
+
+Pré-condição: |v| < COORD_MAX_ABS (valores maiores são saturados, com aviso)
+Pós-condição: retorna a coordenada em centésimos
+*/
+Coord coordDeDouble(double v);
+
+#define coordParaDouble(c) ((double) (c) / ESCALA_COORD)
+
+#elif defined(COORD_FLOAT)
+
+typedef float Coord;
+
+/*
+Converte um valor para float, registrando o erro de arredondamento
+(ver erroMaximoCoord).
+*/
+Coord coordDeDouble(double v);
+
+#define coordParaDouble(c) ((double) (c))
+
+#else
+
+typedef double Coord;
+
+#define coordDeDouble(v) ((Coord) (v))
+#define coordParaDouble(c) ((double) (c))
+
+#endif
+
+#if defined(COORD_FIXA) || defined(COORD_FLOAT)
+typedef float Espessura;
+#else
+typedef double Espessura;
+#endif
+
+/*
+Descrição da representação em uso (para os relatórios de execução).
+*/
+const char* descricaoCoord(void);
+
+/*
+Maior diferença absoluta entre um valor recebido por coordDeDouble e o
+valor guardado, desde o início da execução (0 no modo double).
+As formas são criadas e alteradas por uma thread só (a leitura do .geo e
+a aplicação dos efeitos), então o registro não precisa de trava.
+*/
+double erroMaximoCoord(void);
+
+#endif
@@ -1,4 +1,5 @@
 #include "geometria.h"
+#include "predicados.h"
 #define PI 3.14159265358979323846
 
 #include <math.h>
@@ -20,23 +21,13 @@ double orientacao(Ponto p, Ponto q, Ponto r) {
     double rx = getXPonto(r);
     double ry = getYPonto(r);
     
-    double valor = (qy - py) * (rx - qx) - (qx - px) * (ry - qy);
-    
-    if (fabs(valor) < EPSILON) {
-        return 0.0;
-    }
-    
-    return valor;
+    // (qy - py) * (rx - qx) - (qx - px) * (ry - qy) é o oposto de orient2d(p, q, r)
+    return -orient2dCoord(px, py, qx, qy, rx, ry);
 }
 
 int direcaoOrientacao(Ponto p, Ponto q, Ponto r) {
     double val = orientacao(p, q, r);
-    
-    if (fabs(val) < EPSILON) {
-        return 0;
-    }
-    
-    return (val > 0) ? 1 : -1;
+    return (val > 0) - (val < 0);
 }
 
 /*                    FUNÇÕES DE INTERSEÇÃO                    */
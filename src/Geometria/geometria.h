@@ -28,8 +28,8 @@ Fórmula: orientação = (qy - py) * (rx - qx) - (qx - px) * (ry - qy)
 * r: terceiro ponto
 
 Pré-condição: p, q e r devem ser válidos
-Pós-condição: retorna:
-  - 0.0 se colineares (com tolerância de 1e-10)
+Pós-condição: retorna (sinal exato, ver predicados.h):
+  - 0.0 se colineares
   - valor > 0 se orientação anti-horária (esquerda)
   - valor < 0 se orientação horária (direita)
 */
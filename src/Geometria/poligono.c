@@ -1,11 +1,22 @@
 #include "poligono.h"
 #include "geometria.h"
+#include "vetortipado.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
 
+// Cópia das coordenadas dos vértices, por valor e em ordem: os laços de
+// pontoNoPoligono e areaPoligono percorrem este vetor em vez de buscar
+// cada Ponto na lista
+typedef struct {
+    double x, y;
+} CoordVertice;
+
+VEC_DEFINE(VetorCoords, CoordVertice)
+
 typedef struct poligono {
     Lista vertices;      
+    VetorCoords coords;
     Lista segmentos;     
     BoundingBox bbox;    
 } PoligonoStruct;
@@ -20,6 +31,7 @@ Poligono criaPoligono() {
     }
     
     p->vertices = criaLista();
+    VetorCoords_inicia(&p->coords);
     p->segmentos = criaLista();
     p->bbox = criaBoundingBoxVazia();
     
@@ -42,6 +54,7 @@ void destroiPoligono(Poligono p) {
     PoligonoStruct *poli = (PoligonoStruct*) p;
     
     destroiListaCompleta(poli->vertices, (void (*)(void*))destroiPonto);
+    VetorCoords_libera(&poli->coords);
     destroiListaCompleta(poli->segmentos, (void (*)(void*))destroiSegmento);
     destroiBoundingBox(poli->bbox);
     
@@ -50,21 +63,31 @@ void destroiPoligono(Poligono p) {
 
 /*                    OPERAÇÕES DE INSERÇÃO                    */
 
-void insertVertice(Poligono p, Ponto v) {
+bool insertVertice(Poligono p, Ponto v) {
     if (p == NULL || v == NULL) {
-        return;
+        return false;
     }
     
     PoligonoStruct *poli = (PoligonoStruct*) p;
     
     Ponto copia = copiaPonto(v);
     if (copia == NULL) {
-        return;
+        return false;
     }
     
-    insereListaFim(poli->vertices, copia);
+    // 'vertices' e 'coords' andam juntos: se um não cresce, o outro desfaz
+    if (!insereListaFim(poli->vertices, copia)) {
+        destroiPonto(copia);
+        return false;
+    }
+    if (!VetorCoords_insere(&poli->coords, (CoordVertice) { getXPonto(copia), getYPonto(copia) })) {
+        removeListaFim(poli->vertices);
+        destroiPonto(copia);
+        return false;
+    }
     
     expandeBBComPonto(poli->bbox, copia);
+    return true;
 }
 
 void insertSegmento(Poligono p, Segmento s) {
@@ -98,25 +121,25 @@ bool pontoNoPoligono(Poligono p, Ponto pt) {
         return false;
     }
     
-    int numVertices = tamanhoLista(poli->vertices);
+    int numVertices = poli->coords.tamanho;
     if (numVertices < 3) {
         return false;
     }
     
     double px = getXPonto(pt);
     double py = getYPonto(pt);
+    const CoordVertice *v = poli->coords.itens;
     
     int cruzamentos = 0;
     int i;
     
     for (i = 0; i < numVertices; i++) {
-        Ponto v1 = (Ponto) getListaPosicao(poli->vertices, i);
-        Ponto v2 = (Ponto) getListaPosicao(poli->vertices, (i + 1) % numVertices);
+        int j = (i + 1 < numVertices) ? i + 1 : 0;
         
-        double x1 = getXPonto(v1);
-        double y1 = getYPonto(v1);
-        double x2 = getXPonto(v2);
-        double y2 = getYPonto(v2);
+        double x1 = v[i].x;
+        double y1 = v[i].y;
+        double x2 = v[j].x;
+        double y2 = v[j].y;
         
         if ((y1 > py) != (y2 > py)) {
             double xIntersecao = (x2 - x1) * (py - y1) / (y2 - y1) + x1;
@@ -202,23 +225,23 @@ double areaPoligono(Poligono p) {
     }
     
     PoligonoStruct *poli = (PoligonoStruct*) p;
-    int numVertices = tamanhoLista(poli->vertices);
+    int numVertices = poli->coords.tamanho;
     
     if (numVertices < 3) {
         return 0.0;
     }
     
+    const CoordVertice *v = poli->coords.itens;
     double area = 0.0;
     int i;
     
     for (i = 0; i < numVertices; i++) {
-        Ponto p1 = (Ponto) getListaPosicao(poli->vertices, i);
-        Ponto p2 = (Ponto) getListaPosicao(poli->vertices, (i + 1) % numVertices);
+        int j = (i + 1 < numVertices) ? i + 1 : 0;
         
-        double x1 = getXPonto(p1);
-        double y1 = getYPonto(p1);
-        double x2 = getXPonto(p2);
-        double y2 = getYPonto(p2);
+        double x1 = v[i].x;
+        double y1 = v[i].y;
+        double x2 = v[j].x;
+        double y2 = v[j].y;
         
         area += (x1 * y2 - x2 * y1);
     }
@@ -275,7 +298,7 @@ void fechaPoligono(Poligono p) {
     }
     
     destroiListaCompleta(poli->segmentos, (void (*)(void*))destroiSegmento);
-    poli->segmentos = criaLista();
+    poli->segmentos = criaListaComCapacidade(numVertices);
     
     int i;
     for (i = 0; i < numVertices; i++) {
@@ -55,9 +55,10 @@ Uma cópia do ponto é criada internamente.
 * v: vértice (ponto) a ser inserido
 
 Pré-condição: p e v devem ser válidos
-Pós-condição: vértice é adicionado e bounding box é atualizada
+Pós-condição: vértice é adicionado e bounding box é atualizada; retorna
+              false (polígono inalterado) em caso de falha
 */
-void insertVertice(Poligono p, Ponto v);
+bool insertVertice(Poligono p, Ponto v);
 
 /*
 Insere um segmento (aresta) no polígono.
@@ -91,7 +92,9 @@ bool pontoNoPoligono(Poligono p, Ponto pt);
 
 /*
 Retorna a lista de vértices do polígono.
-A lista retornada é a lista interna (não uma cópia).
+A lista retornada é a lista interna (não uma cópia) e deve ser usada só
+para leitura: o polígono guarda também as coordenadas por valor, que não
+acompanhariam uma alteração feita direto na lista.
 
 * p: ponteiro para o polígono
 
@@ -1,11 +1,12 @@
 #include "ponto.h"
+#include "coordenada.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
 
 typedef struct ponto {
-    double x;
-    double y;
+    Coord x;
+    Coord y;
 } PontoStruct;
 
 /*                    FUNÇÕES DE CRIAÇÃO E DESTRUIÇÃO                    */
@@ -17,8 +18,8 @@ Ponto criaPonto(double x, double y) {
         return NULL;
     }
     
-    p->x = x;
-    p->y = y;
+    p->x = coordDeDouble(x);
+    p->y = coordDeDouble(y);
     
     return (Ponto) p;
 }
@@ -37,7 +38,7 @@ double getXPonto(Ponto p) {
         return 0.0;
     }
     PontoStruct *pt = (PontoStruct*) p;
-    return pt->x;
+    return coordParaDouble(pt->x);
 }
 
 double getYPonto(Ponto p) {
@@ -45,7 +46,7 @@ double getYPonto(Ponto p) {
         return 0.0;
     }
     PontoStruct *pt = (PontoStruct*) p;
-    return pt->y;
+    return coordParaDouble(pt->y);
 }
 
 /*                    MÉTODOS SET (MODIFICAÇÃO)                    */
@@ -55,7 +56,7 @@ void setXPonto(Ponto p, double x) {
         return;
     }
     PontoStruct *pt = (PontoStruct*) p;
-    pt->x = x;
+    pt->x = coordDeDouble(x);
 }
 
 void setYPonto(Ponto p, double y) {
@@ -63,7 +64,7 @@ void setYPonto(Ponto p, double y) {
         return;
     }
     PontoStruct *pt = (PontoStruct*) p;
-    pt->y = y;
+    pt->y = coordDeDouble(y);
 }
 
 /*                    FUNÇÕES GEOMÉTRICAS                    */
@@ -76,8 +77,8 @@ double distanciaPontos(Ponto p1, Ponto p2) {
     PontoStruct *pt1 = (PontoStruct*) p1;
     PontoStruct *pt2 = (PontoStruct*) p2;
     
-    double dx = pt2->x - pt1->x;
-    double dy = pt2->y - pt1->y;
+    double dx = coordParaDouble(pt2->x) - coordParaDouble(pt1->x);
+    double dy = coordParaDouble(pt2->y) - coordParaDouble(pt1->y);
     
     return sqrt(dx * dx + dy * dy);
 }
@@ -91,8 +92,8 @@ bool pontosIguais(Ponto p1, Ponto p2) {
     PontoStruct *pt2 = (PontoStruct*) p2;
     
     double epsilon = 1e-9;
-    return (fabs(pt1->x - pt2->x) < epsilon) && 
-           (fabs(pt1->y - pt2->y) < epsilon);
+    return (fabs(coordParaDouble(pt1->x) - coordParaDouble(pt2->x)) < epsilon) && 
+           (fabs(coordParaDouble(pt1->y) - coordParaDouble(pt2->y)) < epsilon);
 }
 
 Ponto copiaPonto(Ponto p) {
@@ -101,5 +102,5 @@ Ponto copiaPonto(Ponto p) {
     }
     
     PontoStruct *pt = (PontoStruct*) p;
-    return criaPonto(pt->x, pt->y);
+    return criaPonto(coordParaDouble(pt->x), coordParaDouble(pt->y));
 }
\ No newline at end of file
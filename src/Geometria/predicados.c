@@ -0,0 +1,149 @@
+#include "predicados.h"
+#include "coordenada.h"
+
+#include <math.h>
+
+// Limites de erro do filtro (Shewchuk, "Adaptive Precision Floating-Point
+// Arithmetic and Fast Robust Geometric Predicates"): eps = 2^-53
+#define EPS_MAQUINA 1.1102230246251565e-16
+#define ERRO_ORIENT ((3.0 + 16.0 * EPS_MAQUINA) * EPS_MAQUINA)
+
+/*                    ARITMÉTICA EXATA (EXPANSÕES)                    */
+
+// a*b = x + y exatamente
+static void produtoExato(double a, double b, double *x, double *y) {
+    *x = a * b;
+    *y = fma(a, b, -*x);
+}
+
+// a+b = x + y exatamente
+static void somaExata(double a, double b, double *x, double *y) {
+    double s = a + b;
+    double bv = s - a;
+    double av = s - bv;
+    *y = (a - av) + (b - bv);
+    *x = s;
+}
+
+/*
+ * Soma b à expansão e[0..n-1] (componentes sem sobreposição, em ordem
+ * crescente de magnitude), descartando zeros. Retorna o novo tamanho.
+ */
+static int somaNaExpansao(double *e, int n, double b) {
+    double q = b;
+    int m = 0;
+    for (int i = 0; i < n; i++) {
+        double h;
+        somaExata(q, e[i], &q, &h);
+        if (h != 0.0) e[m++] = h;
+    }
+    if (q != 0.0) e[m++] = q;
+    return m;
+}
+
+// Sinal da expansão: o do componente mais significativo
+static double valorExpansao(const double *e, int n) {
+    return (n > 0) ? e[n - 1] : 0.0;
+}
+
+/*
+ * Soma exata de produtos a[i]*b[i]*sinal[i], i = 0..n-1 (n <= 6);
+ * retorna o componente mais significativo.
+ */
+static double somaProdutosExata(const double *a, const double *b, const int *sinal, int n) {
+    double e[24];
+    int m = 0;
+    for (int i = 0; i < n; i++) {
+        double x, y;
+        produtoExato(a[i], b[i], &x, &y);
+        if (sinal[i] < 0) { x = -x; y = -y; }
+        m = somaNaExpansao(e, m, y);
+        m = somaNaExpansao(e, m, x);
+    }
+    return valorExpansao(e, m);
+}
+
+/*                    ORIENTAÇÃO                    */
+
+double orient2d(double ax, double ay, double bx, double by, double cx, double cy) {
+    double esq = (ax - cx) * (by - cy);
+    double dir = (ay - cy) * (bx - cx);
+    double det = esq - dir;
+
+    // Filtro: o erro de arredondamento não pode trocar o sinal
+    double limite = ERRO_ORIENT * (fabs(esq) + fabs(dir));
+    if (det > limite || -det > limite) {
+        return det;
+    }
+
+    // det = bx*cy - bx*ay - ax*cy - by*cx + by*ax + ay*cx (o termo cx*cy se cancela)
+    const double a[6] = {bx, bx, ax, by, by, ay};
+    const double b[6] = {cy, ay, cy, cx, ax, cx};
+    const int sinal[6] = {1, -1, -1, -1, 1, 1};
+    return somaProdutosExata(a, b, sinal, 6);
+}
+
+int sinalOrient2d(double ax, double ay, double bx, double by, double cx, double cy) {
+    double det = orient2d(ax, ay, bx, by, cx, cy);
+    return (det > 0.0) - (det < 0.0);
+}
+
+#ifdef COORD_FIXA
+
+// Ponto na grade, sem os avisos de coordDeDouble (pontos calculados também passam aqui)
+static int64_t naGrade(double v) {
+    return (int64_t) nearbyint(v * ESCALA_COORD);
+}
+
+// |coordenada| < 2^30: diferenças < 2^31, produtos < 2^62, o determinante cabe em int64
+static int64_t orientInteira(double ax, double ay, double bx, double by, double cx, double cy) {
+    int64_t xa = naGrade(ax), ya = naGrade(ay);
+    return (naGrade(bx) - xa) * (naGrade(cy) - ya) - (naGrade(by) - ya) * (naGrade(cx) - xa);
+}
+
+double orient2dCoord(double ax, double ay, double bx, double by, double cx, double cy) {
+    return (double) orientInteira(ax, ay, bx, by, cx, cy) / ((double) ESCALA_COORD * ESCALA_COORD);
+}
+
+int sinalOrientCoord(double ax, double ay, double bx, double by, double cx, double cy) {
+    int64_t det = orientInteira(ax, ay, bx, by, cx, cy);
+    return (det > 0) - (det < 0);
+}
+
+#else
+
+double orient2dCoord(double ax, double ay, double bx, double by, double cx, double cy) {
+    return orient2d(ax, ay, bx, by, cx, cy);
+}
+
+int sinalOrientCoord(double ax, double ay, double bx, double by, double cx, double cy) {
+    return sinalOrient2d(ax, ay, bx, by, cx, cy);
+}
+
+#endif
+
+/*                    RAIO E SEGMENTO                    */
+
+int ladoRaio(double ox, double oy, double dx, double dy, double px, double py) {
+    double esq = dx * (py - oy);
+    double dir = dy * (px - ox);
+    double det = esq - dir;
+
+    double limite = ERRO_ORIENT * (fabs(esq) + fabs(dir));
+    if (det > limite) return 1;
+    if (-det > limite) return -1;
+
+    // det = dx*py - dx*oy - dy*px + dy*ox
+    const double a[4] = {dx, dx, dy, dy};
+    const double b[4] = {py, oy, px, ox};
+    const int sinal[4] = {1, -1, -1, 1};
+    det = somaProdutosExata(a, b, sinal, 4);
+    return (det > 0.0) - (det < 0.0);
+}
+
+bool raioCruzaSegmento(double ox, double oy, double dx, double dy,
+                       double x1, double y1, double x2, double y2) {
+    int l1 = ladoRaio(ox, oy, dx, dy, x1, y1);
+    int l2 = ladoRaio(ox, oy, dx, dy, x2, y2);
+    return l1 != l2;
+}
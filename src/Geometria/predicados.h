@@ -0,0 +1,74 @@
+#ifndef PREDICADOS_H
+#define PREDICADOS_H
+
+#include <stdbool.h>
+
+/*
+*        MÓDULO DE PREDICADOS GEOMÉTRICOS ROBUSTOS
+*
+*        Testes de orientação com sinal sempre correto para as coordenadas
+*        recebidas, sem tolerâncias arbitrárias. Cada predicado calcula
+*        primeiro a expressão em ponto flutuante e a compara com um limite
+*        de erro (filtro); só quando o resultado pode estar errado ele é
+*        refeito em aritmética exata (expansões de ponto flutuante), o que
+*        em dados comuns quase nunca acontece.
+*
+*        Colinearidade passa a ser exata: só retorna 0 quem é colinear
+*        de fato.
+*/
+
+/*                    ORIENTAÇÃO                    */
+
+/*
+Orientação de c em relação à reta orientada a->b (determinante
+(bx-ax)*(cy-ay) - (by-ay)*(cx-ax)).
+
+Pré-condição: coordenadas finitas
+Pós-condição: retorna um valor com o sinal exato:
+  - > 0 se c está à esquerda de a->b (sentido anti-horário no plano cartesiano)
+  - < 0 se c está à direita
+  - 0 se os três pontos são colineares
+  O módulo é uma aproximação do determinante.
+*/
+double orient2d(double ax, double ay, double bx, double by, double cx, double cy);
+
+/*
+Apenas o sinal de orient2d: 1, -1 ou 0.
+*/
+int sinalOrient2d(double ax, double ay, double bx, double by, double cx, double cy);
+
+/*
+Orientação de pontos do cenário (coordenadas de formas). No modo de
+ponto fixo (COORD_FIXA, ver coordenada.h) os pontos são levados à grade
+e o determinante é calculado em inteiros de 64 bits, exato e sem filtro;
+no modo double equivale a orient2d / sinalOrient2d.
+*/
+double orient2dCoord(double ax, double ay, double bx, double by, double cx, double cy);
+int sinalOrientCoord(double ax, double ay, double bx, double by, double cx, double cy);
+
+/*                    RAIO E SEGMENTO                    */
+
+/*
+Lado de p em relação à reta do raio que sai de (ox, oy) na direção
+(dx, dy): sinal exato de dx*(py-oy) - dy*(px-ox). A direção não precisa
+ser unitária e não é somada à origem, então nada é arredondado antes
+do teste.
+
+Pré-condição: coordenadas finitas
+Pós-condição: retorna 1 (esquerda), -1 (direita) ou 0 (sobre a reta)
+*/
+int ladoRaio(double ox, double oy, double dx, double dy, double px, double py);
+
+/*
+A reta do raio separa (ou toca) as extremidades do segmento (x1,y1)-(x2,y2)?
+Equivale ao teste 0 <= u <= 1 do parâmetro ao longo do segmento, mas sem
+divisão nem tolerância. Segmentos sobre a própria reta do raio (paralelos
+colineares) retornam false.
+
+Pré-condição: coordenadas finitas
+Pós-condição: retorna true se as extremidades não estão do mesmo lado
+*/
+bool raioCruzaSegmento(double ox, double oy, double dx, double dy,
+                       double x1, double y1, double x2, double y2);
+
+#endif
@@ -112,4 +112,189 @@ void mergeSortHibrido(void *base, size_t nmemb, size_t size,
     
     unsigned char *arr = (unsigned char *)base;
     mergeSortHibridoRec(arr, 0, nmemb - 1, size, compar, limiarInsertionSort);
-}
\ No newline at end of file
+}
+
+/*                    MERGE SORT PARALELO                    */
+
+// Abaixo deste número de elementos não compensa dividir entre threads
+#define LIMIAR_PARALELO 8192
+
+typedef int (*Comparador)(const void *, const void *);
+
+/*
+Intercala src[a0..a1) e src[b0..b1) em dst a partir da posição k.
+Elementos iguais da primeira metade vêm antes.
+*/
+static void intercala(unsigned char *dst, const unsigned char *src,
+                      size_t a0, size_t a1, size_t b0, size_t b1, size_t k,
+                      size_t size, Comparador compar) {
+    while (a0 < a1 && b0 < b1) {
+        if (compar(src + a0 * size, src + b0 * size) <= 0) {
+            memcpy(dst + k * size, src + a0 * size, size);
+            a0++;
+        } else {
+            memcpy(dst + k * size, src + b0 * size, size);
+            b0++;
+        }
+        k++;
+    }
+    memcpy(dst + k * size, src + a0 * size, (a1 - a0) * size);
+    k += a1 - a0;
+    memcpy(dst + k * size, src + b0 * size, (b1 - b0) * size);
+}
+
+/*
+Merge sort híbrido de arr[inicio..fim] usando aux (mesmas posições) como
+buffer da intercalação.
+*/
+static void ordenaComAux(unsigned char *arr, unsigned char *aux, size_t inicio, size_t fim,
+                         size_t size, size_t limiar, Comparador compar) {
+    if (inicio >= fim) {
+        return;
+    }
+
+    size_t tamanho = fim - inicio + 1;
+    if (tamanho <= limiar) {
+        insertionSortRange(arr, inicio, fim, size, compar);
+        return;
+    }
+
+    size_t meio = inicio + (fim - inicio) / 2;
+    ordenaComAux(arr, aux, inicio, meio, size, limiar, compar);
+    ordenaComAux(arr, aux, meio + 1, fim, size, limiar, compar);
+
+    memcpy(aux + inicio * size, arr + inicio * size, tamanho * size);
+    intercala(arr, aux, inicio, meio + 1, meio + 1, fim + 1, inicio, size, compar);
+}
+
+/*
+Quantos elementos de src[a0..a1) ficam entre os k primeiros da intercalação
+com src[b0..b1) (busca binária no "caminho" da intercalação).
+*/
+static size_t divideIntercalacao(const unsigned char *src, size_t a0, size_t a1, size_t b0, size_t b1,
+                                 size_t k, size_t size, Comparador compar) {
+    size_t na = a1 - a0, nb = b1 - b0;
+    size_t lo = (k > nb) ? k - nb : 0;
+    size_t hi = (k < na) ? k : na;
+    while (lo < hi) {
+        size_t i = lo + (hi - lo) / 2;
+        size_t j = k - i;
+        // a[i] <= b[j-1]: a[i] sai antes de b[j-1], então i é pequeno demais
+        if (compar(src + (a0 + i) * size, src + (b0 + j - 1) * size) <= 0) lo = i + 1;
+        else hi = i;
+    }
+    return lo;
+}
+
+typedef struct {
+    unsigned char *dst;
+    const unsigned char *src;
+    unsigned char *aux;         // só para a ordenação dos blocos
+    size_t a0, a1, b0, b1, k;
+    size_t size;
+    size_t limiar;
+    Comparador compar;
+} TarefaMerge;
+
+static void tarefaOrdenaBloco(void *arg) {
+    TarefaMerge *t = (TarefaMerge *)arg;
+    ordenaComAux(t->dst, t->aux, t->a0, t->a1 - 1, t->size, t->limiar, t->compar);
+}
+
+static void tarefaIntercala(void *arg) {
+    TarefaMerge *t = (TarefaMerge *)arg;
+    intercala(t->dst, t->src, t->a0, t->a1, t->b0, t->b1, t->k, t->size, t->compar);
+}
+
+static void submeteOuExecuta(PoolThreads pool, void (*tarefa)(void*), TarefaMerge *t) {
+    if (!submetePoolThreads(pool, tarefa, t)) {
+        tarefa(t);
+    }
+}
+
+void mergeSortHibridoParalelo(void *base, size_t nmemb, size_t size,
+                              int (*compar)(const void *, const void *),
+                              size_t limiarInsertionSort, PoolThreads pool) {
+    if (base == NULL || compar == NULL || nmemb <= 1) {
+        return;
+    }
+
+    // Um bloco por thread, sem blocos menores que LIMIAR_PARALELO
+    size_t blocos = (size_t) getNumThreadsPool(pool);
+    if (blocos > nmemb / LIMIAR_PARALELO) {
+        blocos = nmemb / LIMIAR_PARALELO;
+    }
+    if (blocos <= 1) {
+        mergeSortHibrido(base, nmemb, size, compar, limiarInsertionSort);
+        return;
+    }
+
+    // Uma tarefa por bloco na primeira fase; nas intercalações, cada leva
+    // tem no máximo blocos + pares tarefas
+    unsigned char *aux = (unsigned char *)malloc(nmemb * size);
+    size_t *limites = (size_t *)malloc((blocos + 1) * sizeof(size_t));
+    TarefaMerge *tarefas = (TarefaMerge *)malloc(2 * blocos * sizeof(TarefaMerge));
+    if (aux == NULL || limites == NULL || tarefas == NULL) {
+        fprintf(stderr, "Erro: falha ao alocar buffer do merge sort paralelo.\n");
+        free(aux);
+        free(limites);
+        free(tarefas);
+        mergeSortHibrido(base, nmemb, size, compar, limiarInsertionSort);
+        return;
+    }
+
+    unsigned char *arr = (unsigned char *)base;
+    for (size_t b = 0; b <= blocos; b++) {
+        limites[b] = nmemb * b / blocos;
+    }
+
+    // Blocos ordenados de forma independente, um por tarefa
+    for (size_t b = 0; b < blocos; b++) {
+        tarefas[b] = (TarefaMerge){ arr, NULL, aux, limites[b], limites[b + 1], 0, 0, 0,
+                                    size, limiarInsertionSort, compar };
+        submeteOuExecuta(pool, tarefaOrdenaBloco, &tarefas[b]);
+    }
+    aguardaPoolThreads(pool);
+
+    // Intercalações de baixo para cima, alternando entre arr e aux; cada
+    // passada é uma leva de tarefas seguida de uma espera pelo pool
+    unsigned char *src = arr, *dst = aux;
+    for (size_t largura = 1; largura < blocos; largura *= 2) {
+        size_t pares = (blocos + 2 * largura - 1) / (2 * largura);
+        size_t partes = (blocos + pares - 1) / pares;
+        size_t n = 0;
+
+        for (size_t b = 0; b < blocos; b += 2 * largura) {
+            size_t a0 = limites[b];
+            size_t a1 = limites[(b + largura < blocos) ? b + largura : blocos];
+            size_t b1 = limites[(b + 2 * largura < blocos) ? b + 2 * largura : blocos];
+            size_t total = b1 - a0;
+
+            size_t i0 = 0;
+            for (size_t p = 0; p < partes; p++) {
+                size_t k1 = total * (p + 1) / partes;
+                size_t i1 = divideIntercalacao(src, a0, a1, a1, b1, k1, size, compar);
+                size_t k0 = total * p / partes;
+                tarefas[n] = (TarefaMerge){ dst, src, NULL, a0 + i0, a0 + i1,
+                                            a1 + (k0 - i0), a1 + (k1 - i1), a0 + k0,
+                                            size, 0, compar };
+                submeteOuExecuta(pool, tarefaIntercala, &tarefas[n]);
+                n++;
+                i0 = i1;
+            }
+        }
+        aguardaPoolThreads(pool);
+
+        unsigned char *tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    if (src != arr) {
+        memcpy(arr, src, nmemb * size);
+    }
+
+    free(tarefas);
+    free(limites);
+    free(aux);
+}
@@ -4,6 +4,8 @@
 
 #include <stddef.h>
 
+#include "poolthreads.h"
+
 /*
 *        MÓDULO DE MERGE SORT HÍBRIDO
 *
@@ -46,4 +48,28 @@ Pós-condição: vetor ordenado
 */
 void mergeSortHibrido(void *base, size_t nmemb, size_t size, int (*compar)(const void *, const void *), size_t limiarInsertionSort);
 
+/*
+Ordena um vetor usando Merge Sort híbrido paralelo.
+
+Aloca um único buffer auxiliar no início (em vez de dois por intercalação).
+O vetor é dividido em um bloco por thread do pool, ordenados como tarefas
+do pool; depois os blocos são intercalados aos pares, cada intercalação
+dividida por busca binária em partes que também viram tarefas. Subvetores
+com até limiarInsertionSort elementos usam Insertion Sort. O resultado é
+estável, igual ao de mergeSortHibrido.
+
+* base: ponteiro para o início do vetor
+* nmemb: número de elementos no vetor
+* size: tamanho de cada elemento em bytes
+* compar: função de comparação
+* limiarInsertionSort: tamanho máximo para usar insertion sort
+* pool: pool que executa as tarefas (NULL ou 1 thread: ordena nesta thread)
+
+Pré-condição: base e compar válidos, limiarInsertionSort > 0; não pode ser
+              chamada de dentro de uma tarefa do próprio pool (ela espera
+              pelo pool inteiro)
+Pós-condição: vetor ordenado
+*/
+void mergeSortHibridoParalelo(void *base, size_t nmemb, size_t size, int (*compar)(const void *, const void *), size_t limiarInsertionSort, PoolThreads pool);
+
 #endif
\ No newline at end of file
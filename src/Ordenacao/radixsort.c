@@ -0,0 +1,106 @@
+#include "radixsort.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BITS_DIGITO 8
+#define BALDES (1 << BITS_DIGITO)
+
+uint64_t chaveOrdenavelDouble(double valor) {
+    uint64_t bits;
+
+    valor += 0.0;   /* -0.0 vira 0.0 */
+    memcpy(&bits, &valor, sizeof(bits));
+
+    /* Positivos: liga o bit de sinal. Negativos: inverte tudo,
+       para que valores mais negativos fiquem com chaves menores. */
+    if (bits & ((uint64_t)1 << 63)) {
+        return ~bits;
+    }
+    return bits | ((uint64_t)1 << 63);
+}
+
+/*
+Distribui 'origem' em 'destino' pelo dígito dado (counting sort estável).
+Retorna 0 se a passada foi pulada (todos os dígitos iguais).
+*/
+static int passadaDigito(const ParRadix *origem, ParRadix *destino, size_t n, int deslocamento) {
+    size_t contagem[BALDES] = {0};
+    size_t i;
+
+    for (i = 0; i < n; i++) {
+        contagem[(origem[i].chave >> deslocamento) & (BALDES - 1)]++;
+    }
+
+    /* Se todos caem no mesmo balde, a ordem não muda */
+    if (contagem[(origem[0].chave >> deslocamento) & (BALDES - 1)] == n) {
+        return 0;
+    }
+
+    size_t soma = 0;
+    for (i = 0; i < BALDES; i++) {
+        size_t c = contagem[i];
+        contagem[i] = soma;
+        soma += c;
+    }
+
+    for (i = 0; i < n; i++) {
+        destino[contagem[(origem[i].chave >> deslocamento) & (BALDES - 1)]++] = origem[i];
+    }
+    return 1;
+}
+
+/*
+Passada pelo bit de desempate: zeros antes dos uns, mantendo a ordem.
+Retorna 0 se a passada foi pulada.
+*/
+static int passadaBitBaixo(const ParRadix *origem, ParRadix *destino, size_t n) {
+    size_t zeros = 0;
+    size_t i;
+
+    for (i = 0; i < n; i++) {
+        if (origem[i].bitBaixo == 0) zeros++;
+    }
+    if (zeros == 0 || zeros == n) {
+        return 0;
+    }
+
+    size_t posZero = 0, posUm = zeros;
+    for (i = 0; i < n; i++) {
+        if (origem[i].bitBaixo == 0) destino[posZero++] = origem[i];
+        else destino[posUm++] = origem[i];
+    }
+    return 1;
+}
+
+bool radixSortPares(ParRadix *pares, size_t n) {
+    if (pares == NULL || n <= 1) {
+        return true;
+    }
+
+    ParRadix *aux = (ParRadix *)malloc(n * sizeof(ParRadix));
+    if (aux == NULL) {
+        fprintf(stderr, "Erro: falha ao alocar buffer do radix sort.\n");
+        return false;
+    }
+
+    ParRadix *origem = pares;
+    ParRadix *destino = aux;
+
+    if (passadaBitBaixo(origem, destino, n)) {
+        ParRadix *t = origem; origem = destino; destino = t;
+    }
+
+    for (int deslocamento = 0; deslocamento < 64; deslocamento += BITS_DIGITO) {
+        if (passadaDigito(origem, destino, n, deslocamento)) {
+            ParRadix *t = origem; origem = destino; destino = t;
+        }
+    }
+
+    if (origem != pares) {
+        memcpy(pares, origem, n * sizeof(ParRadix));
+    }
+    free(aux);
+    return true;
+}
@@ -0,0 +1,52 @@
+#ifndef RADIXSORT_H
+#define RADIXSORT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+*        MÓDULO DE RADIX SORT (LSD)
+*
+*        Ordena pares (chave, índice) sem função de comparação.
+*        A chave tem 65 bits: 64 bits de 'chave' mais um bit de desempate
+*        menos significativo ('bitBaixo'). O algoritmo é estável, então
+*        pares com chave e desempate iguais mantêm a ordem de entrada.
+*        Usado para os eventos da visibilidade (ângulo + início/fim) com -to r.
+*/
+
+typedef struct {
+    uint64_t chave;     /* parte mais significativa da chave */
+    int bitBaixo;       /* desempate: 0 ou 1 (bit menos significativo) */
+    int indice;         /* posição do elemento no vetor original */
+} ParRadix;
+
+/*
+Converte um double em uma chave de 64 bits que preserva a ordem:
+a < b (como double) se e somente se chave(a) < chave(b) (sem sinal).
+-0.0 e 0.0 geram a mesma chave. NaN não é suportado.
+
+* valor: número a converter
+
+Pré-condição: valor não é NaN
+Pós-condição: retorna a chave ordenável
+*/
+uint64_t chaveOrdenavelDouble(double valor);
+
+/*
+Ordena os pares por (chave, bitBaixo) em ordem crescente usando LSD radix sort:
+uma passada pelo bit de desempate e até 8 passadas de 8 bits pela chave.
+Passadas em que todos os pares têm o mesmo dígito são puladas.
+
+Complexidade: O(n) por passada, com um buffer auxiliar de n pares
+
+* pares: vetor de pares
+* n: número de pares
+
+Pré-condição: pares deve ser válido (ou n == 0)
+Pós-condição: pares ordenados de forma estável; retorna false (pares
+              intactos) se faltar memória para o buffer auxiliar
+*/
+bool radixSortPares(ParRadix *pares, size_t n);
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef SORT_TIPADO_H
+#define SORT_TIPADO_H
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+*        MERGE SORT ESPECIALIZADO POR TIPO (GERADO POR MACRO)
+*
+*        As versões de ordenacao.h e mergersort.h recebem o comparador por
+*        ponteiro de função, o que impede o compilador de inlinar a comparação.
+*        SORT_TIPADO_DEFINE gera uma cópia do Merge Sort híbrido para um tipo
+*        concreto, com a comparação escrita como expressão:
+*
+*            #define MENOR_X(a, b) ((a)->campo < (b)->campo)
+*            SORT_TIPADO_DEFINE(ordena_x, TipoX, MENOR_X)
+*
+*        gera:
+*
+*            static void ordena_x(TipoX *v, size_t n, size_t limiar);
+*
+*        MENOR(a, b) recebe dois 'const Tipo*' e deve ser verdadeira se e
+*        somente se *a vem estritamente antes de *b. A ordenação é estável e
+*        subvetores com até 'limiar' elementos usam Insertion Sort. Se faltar
+*        memória para o buffer auxiliar, o vetor inteiro é ordenado por
+*        Insertion Sort (mais lento, mas o resultado é o mesmo).
+*        Deve ser usada em um .c (as funções geradas são static).
+*/
+
+#define SORT_TIPADO_DEFINE(nome, Tipo, MENOR)                                        \
+                                                                                     \
+static inline void nome##_insercao(Tipo *v, size_t ini, size_t fim) {                \
+    for (size_t i = ini + 1; i <= fim; i++) {                                        \
+        Tipo chave = v[i];                                                           \
+        size_t j = i;                                                                \
+        while (j > ini && MENOR(&chave, &v[j - 1])) {                                \
+            v[j] = v[j - 1];                                                         \
+            j--;                                                                     \
+        }                                                                            \
+        v[j] = chave;                                                                \
+    }                                                                                \
+}                                                                                    \
+                                                                                     \
+static inline void nome##_rec(Tipo *v, Tipo *aux, size_t ini, size_t fim,            \
+                              size_t limiar) {                                       \
+    if (fim - ini + 1 <= limiar) {                                                   \
+        nome##_insercao(v, ini, fim);                                                \
+        return;                                                                      \
+    }                                                                                \
+    size_t meio = ini + (fim - ini) / 2;                                             \
+    nome##_rec(v, aux, ini, meio, limiar);                                           \
+    nome##_rec(v, aux, meio + 1, fim, limiar);                                       \
+                                                                                     \
+    /* Metades já em ordem: nada a intercalar */                                     \
+    if (!MENOR(&v[meio + 1], &v[meio])) {                                            \
+        return;                                                                      \
+    }                                                                                \
+                                                                                     \
+    /* Copia só a metade esquerda; a intercalação escreve em v sem */                \
+    /* sobrescrever elementos da direita ainda não lidos */                          \
+    memcpy(aux + ini, v + ini, (meio - ini + 1) * sizeof(Tipo));                     \
+    size_t i = ini, j = meio + 1, k = ini;                                           \
+    while (i <= meio && j <= fim) {                                                  \
+        if (MENOR(&v[j], &aux[i])) {                                                 \
+            v[k++] = v[j++];                                                         \
+        } else {                                                                     \
+            v[k++] = aux[i++];                                                       \
+        }                                                                            \
+    }                                                                                \
+    while (i <= meio) {                                                              \
+        v[k++] = aux[i++];                                                           \
+    }                                                                                \
+}                                                                                    \
+                                                                                     \
+static inline void nome(Tipo *v, size_t n, size_t limiar) {                          \
+    if (v == NULL || n <= 1) {                                                       \
+        return;                                                                      \
+    }                                                                                \
+    if (limiar < 1) {                                                                \
+        limiar = 1;                                                                  \
+    }                                                                                \
+    if (n <= limiar) {                                                               \
+        nome##_insercao(v, 0, n - 1);                                                \
+        return;                                                                      \
+    }                                                                                \
+    Tipo *aux = (Tipo *)malloc(n * sizeof(Tipo));                                    \
+    if (aux == NULL) {                                                               \
+        fprintf(stderr, "Erro: falha ao alocar buffer de ordenacao.\n");             \
+        nome##_insercao(v, 0, n - 1);                                                \
+        return;                                                                      \
+    }                                                                                \
+    nome##_rec(v, aux, 0, n - 1, limiar);                                            \
+    free(aux);                                                                       \
+}
+
+#endif
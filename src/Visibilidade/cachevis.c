@@ -0,0 +1,161 @@
+#include "cachevis.h"
+#include "poligonovis.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct {
+    double bx, by;
+    unsigned long epoca;
+    PoligonoVis poligono;       // NULL quando a entrada está livre
+    unsigned long ultimoUso;    // instante do último acesso (para o LRU)
+} EntradaCache;
+
+typedef struct {
+    EntradaCache *entradas;
+    int capacidade;
+    unsigned long relogio;
+    long acertos;
+    long falhas;
+} CacheVisStruct;
+
+/*________________________________ FUNÇÕES AUXILIARES ________________________________*/
+
+// Poucas entradas: a busca linear é mais barata que manter uma tabela hash
+static EntradaCache* procuraEntrada(CacheVisStruct *c, double bx, double by, unsigned long epoca) {
+    for (int i = 0; i < c->capacidade; i++) {
+        EntradaCache *e = &c->entradas[i];
+        if (e->poligono && e->epoca == epoca && e->bx == bx && e->by == by) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+// Entrada livre ou, se não houver, a usada há mais tempo
+static EntradaCache* escolheVitima(CacheVisStruct *c) {
+    EntradaCache *vitima = &c->entradas[0];
+    for (int i = 0; i < c->capacidade; i++) {
+        EntradaCache *e = &c->entradas[i];
+        if (e->poligono == NULL) {
+            return e;
+        }
+        if (e->ultimoUso < vitima->ultimoUso) {
+            vitima = e;
+        }
+    }
+    return vitima;
+}
+
+/*________________________________ FUNÇÕES PÚBLICAS ________________________________*/
+
+CacheVis criaCacheVis(int capacidade) {
+    CacheVisStruct *c = (CacheVisStruct*) malloc(sizeof(CacheVisStruct));
+    if (c == NULL) {
+        fprintf(stderr, "Erro: falha ao alocar cache de visibilidade.\n");
+        return NULL;
+    }
+
+    c->capacidade = (capacidade < 1) ? 1 : capacidade;
+    c->entradas = (EntradaCache*) calloc(c->capacidade, sizeof(EntradaCache));
+    if (c->entradas == NULL) {
+        fprintf(stderr, "Erro: falha ao alocar entradas do cache de visibilidade.\n");
+        free(c);
+        return NULL;
+    }
+    c->relogio = 0;
+    c->acertos = 0;
+    c->falhas = 0;
+
+    return (CacheVis) c;
+}
+
+void destroiCacheVis(CacheVis cache) {
+    if (cache == NULL) {
+        return;
+    }
+
+    CacheVisStruct *c = (CacheVisStruct*) cache;
+    for (int i = 0; i < c->capacidade; i++) {
+        if (c->entradas[i].poligono) {
+            destroiPoligonoVis(c->entradas[i].poligono);
+        }
+    }
+    free(c->entradas);
+    free(c);
+}
+
+PoligonoVis buscaCacheVis(CacheVis cache, double bx, double by, unsigned long epoca) {
+    if (cache == NULL) {
+        return NULL;
+    }
+
+    CacheVisStruct *c = (CacheVisStruct*) cache;
+    EntradaCache *e = procuraEntrada(c, bx, by, epoca);
+    if (e == NULL) {
+        c->falhas++;
+        return NULL;
+    }
+
+    c->acertos++;
+    e->ultimoUso = ++c->relogio;
+    return copiaPoligonoVis(e->poligono);
+}
+
+PoligonoVis buscaCacheVisRecente(CacheVis cache, double bx, double by, unsigned long epocaMax, unsigned long *epoca) {
+    if (cache == NULL) {
+        return NULL;
+    }
+
+    CacheVisStruct *c = (CacheVisStruct*) cache;
+    EntradaCache *melhor = NULL;
+    for (int i = 0; i < c->capacidade; i++) {
+        EntradaCache *e = &c->entradas[i];
+        if (e->poligono && e->bx == bx && e->by == by && e->epoca <= epocaMax &&
+            (melhor == NULL || e->epoca > melhor->epoca)) {
+            melhor = e;
+        }
+    }
+    if (melhor == NULL) {
+        return NULL;
+    }
+
+    melhor->ultimoUso = ++c->relogio;
+    *epoca = melhor->epoca;
+    return copiaPoligonoVis(melhor->poligono);
+}
+
+void insereCacheVis(CacheVis cache, double bx, double by, unsigned long epoca, PoligonoVis poligono) {
+    if (cache == NULL || poligono == NULL) {
+        return;
+    }
+
+    CacheVisStruct *c = (CacheVisStruct*) cache;
+    EntradaCache *e = procuraEntrada(c, bx, by, epoca);
+    if (e == NULL) {
+        e = escolheVitima(c);
+        e->bx = bx;
+        e->by = by;
+        e->epoca = epoca;
+        if (e->poligono) {
+            copiaParaPoligonoVis(e->poligono, poligono);
+        } else {
+            e->poligono = copiaPoligonoVis(poligono);
+        }
+    }
+    e->ultimoUso = ++c->relogio;
+}
+
+long getAcertosCacheVis(CacheVis cache) {
+    if (cache == NULL) {
+        return 0;
+    }
+    return ((CacheVisStruct*) cache)->acertos;
+}
+
+long getFalhasCacheVis(CacheVis cache) {
+    if (cache == NULL) {
+        return 0;
+    }
+    return ((CacheVisStruct*) cache)->falhas;
+}
@@ -0,0 +1,99 @@
+#ifndef CACHEVIS_H
+#define CACHEVIS_H
+
+#include "poligonovis.h"
+
+/*
+ * TIPO ABSTRATO DE DADOS: CACHE DE POLÍGONOS DE VISIBILIDADE
+ *
+ * Guarda os últimos polígonos calculados, indexados por (bx, by, época).
+ * A época é um contador de versão dos segmentos do cenário: enquanto ela
+ * não muda, o polígono de uma mesma posição de bomba é o mesmo.
+ * Quando o cache está cheio, a entrada usada há mais tempo (LRU) é descartada.
+ *
+ * O cache guarda cópias: quem insere e quem busca continua dono da
+ * próprio polígono. Entradas substituídas reaproveitam o bloco de vértices.
+ */
+
+typedef void* CacheVis;
+
+/*________________________________ FUNÇÕES DE CRIAÇÃO E DESTRUIÇÃO ________________________________*/
+
+/*
+ * Cria um cache vazio.
+ *
+ * capacidade: número máximo de polígonos guardados (valores < 1 viram 1)
+ *
+ * Pré-condição: nenhuma
+ * Pós-condição: retorna o cache criado, ou NULL em caso de falha
+ */
+CacheVis criaCacheVis(int capacidade);
+
+/*
+ * Libera o cache e todos os polígonos guardados.
+ *
+ * c: ponteiro para o cache
+ *
+ * Pré-condição: c deve ser válido ou NULL
+ * Pós-condição: memória liberada
+ */
+void destroiCacheVis(CacheVis c);
+
+/*________________________________ OPERAÇÕES ________________________________*/
+
+/*
+ * Procura o polígono de (bx, by) na época informada.
+ * Conta um acerto ou uma falha.
+ *
+ * c: ponteiro para o cache
+ * bx, by: posição da bomba
+ * epoca: época atual dos segmentos do cenário
+ *
+ * Pré-condição: c deve ser válido
+ * Pós-condição: retorna uma cópia do polígono (a ser liberada com
+ *               destroiPoligonoVis), ou NULL se não estiver no cache
+ */
+PoligonoVis buscaCacheVis(CacheVis c, double bx, double by, unsigned long epoca);
+
+/*
+ * Procura o polígono mais recente de (bx, by), de qualquer época anterior
+ * ou igual a 'epocaMax'. Usado para reparar um polígono desatualizado em
+ * vez de recalculá-lo. Não altera os contadores de acertos e falhas.
+ *
+ * c: ponteiro para o cache
+ * bx, by: posição da bomba
+ * epocaMax: maior época aceita
+ * epoca: recebe a época do polígono encontrado
+ *
+ * Pré-condição: c e epoca devem ser válidos
+ * Pós-condição: retorna uma cópia do polígono, ou NULL se não houver
+ */
+PoligonoVis buscaCacheVisRecente(CacheVis c, double bx, double by, unsigned long epocaMax, unsigned long *epoca);
+
+/*
+ * Guarda uma cópia do polígono de (bx, by) na época informada,
+ * descartando a entrada menos usada recentemente se o cache estiver cheio.
+ *
+ * c: ponteiro para o cache
+ * bx, by: posição da bomba
+ * epoca: época dos segmentos usada no cálculo
+ * poligono: polígono calculado (não é modificado)
+ *
+ * Pré-condição: c deve ser válido
+ * Pós-condição: polígono disponível para buscaCacheVis (NULL é ignorado)
+ */
+void insereCacheVis(CacheVis c, double bx, double by, unsigned long epoca, PoligonoVis poligono);
+
+/*________________________________ ESTATÍSTICAS ________________________________*/
+
+/*
+ * Retorna o número de buscas que encontraram o polígono.
+ */
+long getAcertosCacheVis(CacheVis c);
+
+/*
+ * Retorna o número de buscas que não encontraram o polígono.
+ */
+long getFalhasCacheVis(CacheVis c);
+
+#endif
@@ -0,0 +1,118 @@
+#include "diffsegmentos.h"
+#include "linha.h"
+#include "retangulo.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct {
+    double x1, y1;
+    double x2, y2;
+} SegmentoDiff;
+
+typedef struct {
+    SegmentoDiff *segs;
+    int qtd;
+    int capacidade;
+    bool incompleto;    // algum segmento não pôde ser registrado
+} DiffSegmentosStruct;
+
+DiffSegmentos criaDiffSegmentos() {
+    DiffSegmentosStruct *d = (DiffSegmentosStruct*) malloc(sizeof(DiffSegmentosStruct));
+    if (d == NULL) {
+        fprintf(stderr, "Erro: falha ao alocar registro de segmentos alterados.\n");
+        return NULL;
+    }
+    d->segs = NULL;
+    d->qtd = 0;
+    d->capacidade = 0;
+    d->incompleto = false;
+    return (DiffSegmentos) d;
+}
+
+void destroiDiffSegmentos(DiffSegmentos diff) {
+    if (diff == NULL) {
+        return;
+    }
+    DiffSegmentosStruct *d = (DiffSegmentosStruct*) diff;
+    free(d->segs);
+    free(d);
+}
+
+void registraSegmentoDiff(DiffSegmentos diff, double x1, double y1, double x2, double y2) {
+    if (diff == NULL) {
+        return;
+    }
+
+    DiffSegmentosStruct *d = (DiffSegmentosStruct*) diff;
+    if (d->qtd >= d->capacidade) {
+        int novaCap = (d->capacidade == 0) ? 8 : d->capacidade * 2;
+        SegmentoDiff *novo = (SegmentoDiff*) realloc(d->segs, novaCap * sizeof(SegmentoDiff));
+        if (novo == NULL) {
+            fprintf(stderr, "Erro: falha ao expandir registro de segmentos alterados.\n");
+            d->incompleto = true;
+            return;
+        }
+        d->segs = novo;
+        d->capacidade = novaCap;
+    }
+
+    SegmentoDiff *s = &d->segs[d->qtd++];
+    s->x1 = x1;
+    s->y1 = y1;
+    s->x2 = x2;
+    s->y2 = y2;
+}
+
+int registraFormaDiff(DiffSegmentos d, Forma f) {
+    if (f == NULL) {
+        return 0;
+    }
+
+    void *obj = getFormaAssoc(f);
+    if (obj == NULL) {
+        return 0;
+    }
+
+    // Mesma decomposição usada na extração de segmentos da visibilidade
+    switch (getFormaTipo(f)) {
+        case TIPO_LINHA:
+            registraSegmentoDiff(d, getX1Linha(obj), getY1Linha(obj), getX2Linha(obj), getY2Linha(obj));
+            return 1;
+
+        case TIPO_RETANGULO: {
+            double x = getXRetangulo(obj);
+            double y = getYRetangulo(obj);
+            double w = getLarguraRetangulo(obj);
+            double h = getAlturaRetangulo(obj);
+            registraSegmentoDiff(d, x, y, x + w, y);
+            registraSegmentoDiff(d, x + w, y, x + w, y + h);
+            registraSegmentoDiff(d, x + w, y + h, x, y + h);
+            registraSegmentoDiff(d, x, y + h, x, y);
+            return 4;
+        }
+
+        default:
+            return 0;
+    }
+}
+
+bool diffCompleto(DiffSegmentos diff) {
+    return diff != NULL && !((DiffSegmentosStruct*) diff)->incompleto;
+}
+
+int getQtdSegmentosDiff(DiffSegmentos diff) {
+    if (diff == NULL) {
+        return 0;
+    }
+    return ((DiffSegmentosStruct*) diff)->qtd;
+}
+
+void getSegmentoDiff(DiffSegmentos diff, int i, double *x1, double *y1, double *x2, double *y2) {
+    DiffSegmentosStruct *d = (DiffSegmentosStruct*) diff;
+    SegmentoDiff *s = &d->segs[i];
+    *x1 = s->x1;
+    *y1 = s->y1;
+    *x2 = s->x2;
+    *y2 = s->y2;
+}
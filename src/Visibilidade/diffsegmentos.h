@@ -0,0 +1,87 @@
+#ifndef DIFFSEGMENTOS_H
+#define DIFFSEGMENTOS_H
+
+#include "formas.h"
+#include <stdbool.h>
+
+/*
+ * TIPO ABSTRATO DE DADOS: SEGMENTOS ALTERADOS
+ *
+ * Registra os segmentos (obstáculos) que entraram ou saíram do cenário
+ * em uma alteração (comandos a, cln e d). Para reparar um polígono de
+ * visibilidade não importa se o segmento entrou ou saiu: em ambos os casos
+ * só mudam os raios dentro do intervalo angular que ele cobre.
+ */
+
+typedef void* DiffSegmentos;
+
+/*________________________________ FUNÇÕES DE CRIAÇÃO E DESTRUIÇÃO ________________________________*/
+
+/*
+ * Cria um registro vazio.
+ *
+ * Pré-condição: nenhuma
+ * Pós-condição: retorna o registro, ou NULL em caso de falha
+ */
+DiffSegmentos criaDiffSegmentos();
+
+/*
+ * Libera o registro.
+ *
+ * d: ponteiro para o registro
+ *
+ * Pré-condição: d deve ser válido ou NULL
+ * Pós-condição: memória liberada
+ */
+void destroiDiffSegmentos(DiffSegmentos d);
+
+/*________________________________ OPERAÇÕES ________________________________*/
+
+/*
+ * Registra um segmento que entrou ou saiu do cenário.
+ *
+ * d: ponteiro para o registro
+ * x1, y1, x2, y2: extremidades do segmento
+ *
+ * Pré-condição: d deve ser válido
+ * Pós-condição: segmento registrado; se faltar memória, o registro é
+ *               marcado como incompleto (ver diffCompleto)
+ */
+void registraSegmentoDiff(DiffSegmentos d, double x1, double y1, double x2, double y2);
+
+/*
+ * Registra os segmentos de uma forma que entrou ou saiu do cenário:
+ * a própria linha, ou os 4 lados de um retângulo. Outras formas não
+ * são obstáculos e são ignoradas.
+ *
+ * d: ponteiro para o registro (NULL: só conta os segmentos)
+ * f: forma
+ *
+ * Pré-condição: nenhuma
+ * Pós-condição: retorna o número de segmentos da forma (0 se ela não é
+ *               obstáculo)
+ */
+int registraFormaDiff(DiffSegmentos d, Forma f);
+
+/*________________________________ CONSULTA ________________________________*/
+
+/*
+ * Retorna false se d é NULL ou se algum segmento não pôde ser registrado:
+ * nesse caso o registro não descreve a alteração inteira e não serve para
+ * reparar polígonos (um polígono "reparado" com ele ficaria desatualizado).
+ */
+bool diffCompleto(DiffSegmentos d);
+
+/*
+ * Retorna o número de segmentos registrados.
+ */
+int getQtdSegmentosDiff(DiffSegmentos d);
+
+/*
+ * Copia as extremidades do i-ésimo segmento registrado.
+ *
+ * Pré-condição: 0 <= i < getQtdSegmentosDiff(d)
+ */
+void getSegmentoDiff(DiffSegmentos d, int i, double *x1, double *y1, double *x2, double *y2);
+
+#endif
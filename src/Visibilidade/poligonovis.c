@@ -0,0 +1,208 @@
+#include "poligonovis.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CAPACIDADE_PADRAO 64
+
+typedef struct {
+    double *bloco;      // [xs | ys | angs], cada parte com 'capacidade' posições
+    int qtd;
+    int capacidade;
+} PoligonoVisStruct;
+
+/*________________________________ FUNÇÕES AUXILIARES ________________________________*/
+
+static bool realocaBloco(PoligonoVisStruct *p, int novaCap) {
+    double *novo = (double*) realloc(p->bloco, 3 * (size_t) novaCap * sizeof(double));
+    if (novo == NULL) {
+        fprintf(stderr, "Erro: falha ao expandir poligono de visibilidade.\n");
+        return false;
+    }
+    // Afasta angs e ys para os novos inícios (de trás para frente)
+    memmove(novo + 2 * (size_t) novaCap, novo + 2 * (size_t) p->capacidade, p->qtd * sizeof(double));
+    memmove(novo + novaCap, novo + p->capacidade, p->qtd * sizeof(double));
+    p->bloco = novo;
+    p->capacidade = novaCap;
+    return true;
+}
+
+// Vértices i e j coincidem (dentro da tolerância)?
+static bool repetido(const double *xs, const double *ys, int i, int j, double tol) {
+    if (tol == 0.0) return xs[i] == xs[j] && ys[i] == ys[j];
+    return hypot(xs[j] - xs[i], ys[j] - ys[i]) <= tol;
+}
+
+// b está sobre o lado a-c (perto da reta e entre a e c)?
+static bool dispensavel(const double *xs, const double *ys, int a, int b, int c, double tol) {
+    double abx = xs[b] - xs[a], aby = ys[b] - ys[a];
+    double bcx = xs[c] - xs[b], bcy = ys[c] - ys[b];
+    double acx = xs[c] - xs[a], acy = ys[c] - ys[a];
+    double cruz = abx * acy - aby * acx;
+    if (fabs(cruz) > tol * hypot(acx, acy)) return false;
+    return abx * bcx + aby * bcy >= 0.0;
+}
+
+static void moveVertice(PoligonoVisStruct *p, int de, int para) {
+    p->bloco[para] = p->bloco[de];
+    p->bloco[p->capacidade + para] = p->bloco[p->capacidade + de];
+    p->bloco[2 * p->capacidade + para] = p->bloco[2 * p->capacidade + de];
+}
+
+/*________________________________ FUNÇÕES PÚBLICAS ________________________________*/
+
+PoligonoVis criaPoligonoVis(int capacidade) {
+    PoligonoVisStruct *p = (PoligonoVisStruct*) malloc(sizeof(PoligonoVisStruct));
+    if (p == NULL) {
+        fprintf(stderr, "Erro: falha ao alocar poligono de visibilidade.\n");
+        return NULL;
+    }
+    if (capacidade < 1) capacidade = CAPACIDADE_PADRAO;
+
+    p->bloco = (double*) malloc(3 * (size_t) capacidade * sizeof(double));
+    if (p->bloco == NULL) {
+        fprintf(stderr, "Erro: falha ao alocar poligono de visibilidade.\n");
+        free(p);
+        return NULL;
+    }
+    p->qtd = 0;
+    p->capacidade = capacidade;
+    return (PoligonoVis) p;
+}
+
+void destroiPoligonoVis(PoligonoVis p) {
+    if (p == NULL) {
+        return;
+    }
+    free(((PoligonoVisStruct*) p)->bloco);
+    free(p);
+}
+
+PoligonoVis copiaPoligonoVis(PoligonoVis p) {
+    if (p == NULL) {
+        return NULL;
+    }
+    PoligonoVisStruct *origem = (PoligonoVisStruct*) p;
+    PoligonoVis copia = criaPoligonoVis(origem->qtd);
+    if (copia) {
+        copiaParaPoligonoVis(copia, p);
+    }
+    return copia;
+}
+
+void limpaPoligonoVis(PoligonoVis p) {
+    ((PoligonoVisStruct*) p)->qtd = 0;
+}
+
+void reservaPoligonoVis(PoligonoVis p, int capacidade) {
+    PoligonoVisStruct *pol = (PoligonoVisStruct*) p;
+    if (capacidade > pol->capacidade) {
+        realocaBloco(pol, capacidade);
+    }
+}
+
+void adicionaVerticePoligonoVis(PoligonoVis p, double x, double y, double ang) {
+    PoligonoVisStruct *pol = (PoligonoVisStruct*) p;
+    if (pol->qtd >= pol->capacidade && !realocaBloco(pol, pol->capacidade * 2)) {
+        return;
+    }
+    pol->bloco[pol->qtd] = x;
+    pol->bloco[pol->capacidade + pol->qtd] = y;
+    pol->bloco[2 * pol->capacidade + pol->qtd] = ang;
+    pol->qtd++;
+}
+
+void copiaParaPoligonoVis(PoligonoVis destino, PoligonoVis origem) {
+    PoligonoVisStruct *d = (PoligonoVisStruct*) destino;
+    PoligonoVisStruct *o = (PoligonoVisStruct*) origem;
+    d->qtd = 0;
+    if (o->qtd > d->capacidade && !realocaBloco(d, o->qtd)) {
+        return;
+    }
+    memcpy(d->bloco, o->bloco, o->qtd * sizeof(double));
+    memcpy(d->bloco + d->capacidade, o->bloco + o->capacidade, o->qtd * sizeof(double));
+    memcpy(d->bloco + 2 * d->capacidade, o->bloco + 2 * o->capacidade, o->qtd * sizeof(double));
+    d->qtd = o->qtd;
+}
+
+int simplificaPoligonoVis(PoligonoVis p, double tolerancia) {
+    PoligonoVisStruct *pol = (PoligonoVisStruct*) p;
+    int n = pol->qtd;
+    if (n < 3) return 0;
+    if (tolerancia < 0.0) tolerancia = 0.0;
+
+    const double *xs = pol->bloco;
+    const double *ys = pol->bloco + pol->capacidade;
+
+    // Passada única: os vértices mantidos ficam compactados em [0, saida)
+    int saida = 0;
+    for (int i = 0; i < n; i++) {
+        if (saida > 0 && repetido(xs, ys, saida - 1, i, tolerancia)) continue;
+        moveVertice(pol, i, saida++);
+        while (saida >= 3 && dispensavel(xs, ys, saida - 3, saida - 2, saida - 1, tolerancia)) {
+            moveVertice(pol, saida - 1, saida - 2);
+            saida--;
+        }
+    }
+
+    // Emenda entre o fim e o começo (o polígono é fechado)
+    int inicio = 0;
+    bool mudou = true;
+    while (mudou && saida - inicio >= 3) {
+        mudou = false;
+        if (repetido(xs, ys, saida - 1, inicio, tolerancia) ||
+            dispensavel(xs, ys, saida - 2, saida - 1, inicio, tolerancia)) {
+            saida--;
+            mudou = true;
+        } else if (dispensavel(xs, ys, saida - 1, inicio, inicio + 1, tolerancia)) {
+            inicio++;
+            mudou = true;
+        }
+    }
+    if (inicio > 0) {
+        for (int i = inicio; i < saida; i++) {
+            moveVertice(pol, i, i - inicio);
+        }
+        saida -= inicio;
+    }
+
+    pol->qtd = saida;
+    return n - saida;
+}
+
+bool pontoInternoPoligonoVis(PoligonoVis p, double x, double y) {
+    PoligonoVisStruct *pol = (PoligonoVisStruct*) p;
+    int n = pol->qtd;
+    if (n < 3) return false;
+
+    const double *VX = pol->bloco;
+    const double *VY = pol->bloco + pol->capacidade;
+    bool inside = false;
+    for (int i = 0, j = n - 1; i < n; j = i++) {
+        if (((VY[i] > y) != (VY[j] > y)) &&
+            (x < (VX[j] - VX[i]) * (y - VY[i]) / (VY[j] - VY[i]) + VX[i])) {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
+
+int getQtdVerticesPoligonoVis(PoligonoVis p) {
+    return ((PoligonoVisStruct*) p)->qtd;
+}
+
+const double* getXsPoligonoVis(PoligonoVis p) {
+    return ((PoligonoVisStruct*) p)->bloco;
+}
+
+const double* getYsPoligonoVis(PoligonoVis p) {
+    PoligonoVisStruct *pol = (PoligonoVisStruct*) p;
+    return pol->bloco + pol->capacidade;
+}
+
+const double* getAngsPoligonoVis(PoligonoVis p) {
+    PoligonoVisStruct *pol = (PoligonoVisStruct*) p;
+    return pol->bloco + 2 * pol->capacidade;
+}
@@ -0,0 +1,105 @@
+#ifndef POLIGONOVIS_H
+#define POLIGONOVIS_H
+
+#include <stdbool.h>
+
+/*
+ * TIPO ABSTRATO DE DADOS: POLÍGONO DE VISIBILIDADE
+ *
+ * Vértices guardados em um único bloco de memória, em três vetores
+ * contíguos (xs, ys e o ângulo do raio que gerou cada vértice), mais a
+ * quantidade. O bloco só é realocado quando falta espaço: limpar o
+ * polígono mantém a capacidade, então o mesmo objeto pode ser reutilizado
+ * por várias consultas sem novas alocações.
+ *
+ * Os vetores devolvidos pelos getters são válidos até a próxima inserção.
+ */
+
+typedef void* PoligonoVis;
+
+/*________________________________ FUNÇÕES DE CRIAÇÃO E DESTRUIÇÃO ________________________________*/
+
+/*
+ * Cria um polígono vazio.
+ *
+ * capacidade: número de vértices reservados (valores < 1 usam um padrão)
+ *
+ * Pré-condição: nenhuma
+ * Pós-condição: retorna o polígono, ou NULL em caso de falha
+ */
+PoligonoVis criaPoligonoVis(int capacidade);
+
+/*
+ * Libera o polígono.
+ *
+ * p: ponteiro para o polígono
+ *
+ * Pré-condição: p deve ser válido ou NULL
+ * Pós-condição: memória liberada
+ */
+void destroiPoligonoVis(PoligonoVis p);
+
+/*
+ * Cria uma cópia independente (NULL se p for NULL).
+ */
+PoligonoVis copiaPoligonoVis(PoligonoVis p);
+
+/*________________________________ OPERAÇÕES ________________________________*/
+
+/*
+ * Remove todos os vértices, mantendo a capacidade.
+ */
+void limpaPoligonoVis(PoligonoVis p);
+
+/*
+ * Garante espaço para 'capacidade' vértices sem novas realocações.
+ */
+void reservaPoligonoVis(PoligonoVis p, int capacidade);
+
+/*
+ * Insere um vértice no fim.
+ *
+ * p: ponteiro para o polígono
+ * x, y: coordenadas do vértice
+ * ang: ângulo do raio que gerou o vértice (visto da bomba)
+ *
+ * Pré-condição: p deve ser válido
+ * Pós-condição: vértice inserido (o bloco dobra de tamanho se necessário)
+ */
+void adicionaVerticePoligonoVis(PoligonoVis p, double x, double y, double ang);
+
+/*
+ * Copia os vértices de 'origem' para 'destino', reaproveitando o bloco
+ * de 'destino' quando ele já tem capacidade suficiente.
+ */
+void copiaParaPoligonoVis(PoligonoVis destino, PoligonoVis origem);
+
+/*
+ * Simplifica o polígono no próprio bloco: remove vértices repetidos
+ * (a até 'tolerancia' do anterior) e vértices no meio de dois vizinhos
+ * colineares (a até 'tolerancia' da reta entre eles e entre os dois).
+ * Com tolerancia = 0 só sai o que não muda o polígono: repetições exatas
+ * e vértices exatamente sobre o lado formado pelos vizinhos.
+ *
+ * p: ponteiro para o polígono
+ * tolerancia: distância máxima (>= 0)
+ *
+ * Pré-condição: p deve ser válido
+ * Pós-condição: retorna o número de vértices removidos
+ */
+int simplificaPoligonoVis(PoligonoVis p, double tolerancia);
+
+/*
+ * Retorna true se (x, y) está dentro do polígono (regra par-ímpar).
+ * Polígonos com menos de 3 vértices não contêm nenhum ponto.
+ */
+bool pontoInternoPoligonoVis(PoligonoVis p, double x, double y);
+
+/*________________________________ GETTERS ________________________________*/
+
+int getQtdVerticesPoligonoVis(PoligonoVis p);
+const double* getXsPoligonoVis(PoligonoVis p);
+const double* getYsPoligonoVis(PoligonoVis p);
+const double* getAngsPoligonoVis(PoligonoVis p);
+
+#endif
@@ -1,6 +1,7 @@
 #include "segsativos.h"
 #include "segmento.h"
 #include "ponto.h"  
+#include "predicados.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
@@ -53,16 +54,16 @@ double y2 = getYPonto(p2);
     // Calcula interseção raio-segmento usando determinantes
     double det = dx_raio * dy_seg - dy_raio * dx_seg;
     
-    if (fabs(det) < 1e-10) {
-        // Raio e segmento são paralelos
+    // Teste exato: a reta do raio precisa separar (ou tocar) as extremidades
+    // (substitui o teste 0 <= u <= 1 e o de paralelismo com tolerância)
+    if (!raioCruzaSegmento(px, py, dx_raio, dy_raio, x1, y1, x2, y2) || det == 0.0) {
         return INFINITY;
     }
     
     double t = (dx_p1 * dy_seg - dy_p1 * dx_seg) / det;
-    double u = (dx_p1 * dy_raio - dy_p1 * dx_raio) / det;
     
-    // Verifica se a interseção está no raio (t >= 0) e no segmento (0 <= u <= 1)
-    if (t >= 0 && u >= 0 && u <= 1) {
+    // Verifica se a interseção está no raio (t >= 0)
+    if (t >= 0) {
         return t;  // Distância ao longo do raio
     }
     
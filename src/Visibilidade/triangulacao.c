@@ -0,0 +1,837 @@
+#include "triangulacao.h"
+#include "predicados.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Tolerância de distância, relativa à extensão da cena
+#define TOLERANCIA_RELATIVA 1e-9
+
+// Folga da caixa do domínio, em múltiplos da extensão da cena
+#define FOLGA_DOMINIO 0.5
+
+typedef struct {
+    int v[3];           // vértices em sentido anti-horário
+    int viz[3];         // viz[i]: triângulo do outro lado da aresta oposta a v[i] (-1: borda)
+    bool restrita[3];   // a aresta oposta a v[i] é um obstáculo
+} Triangulo;
+
+typedef struct {
+    double *x, *y;
+    int *triDoVertice;  // um triângulo qualquer que contém o vértice
+    int qtdVert, capVert;
+
+    Triangulo *tri;
+    int qtdTri, capTri;
+
+    int qtdRestritas;
+    double tol;         // tolerância de distância (pontos coincidentes, colinearidade)
+    double minX, minY, maxX, maxY;
+} TriangulacaoStruct;
+
+// Pilha/fila simples de inteiros
+typedef struct {
+    int *v;
+    int qtd, cap, ini;
+} VetorInt;
+
+/*________________________________ FUNÇÕES AUXILIARES ________________________________*/
+
+static void empilhaInt(VetorInt *p, int valor) {
+    if (p->qtd >= p->cap) {
+        p->cap = (p->cap == 0) ? 64 : p->cap * 2;
+        p->v = realloc(p->v, p->cap * sizeof(int));
+    }
+    p->v[p->qtd++] = valor;
+}
+
+static double orientV(TriangulacaoStruct *T, int a, int b, int c) {
+    return orient2d(T->x[a], T->y[a], T->x[b], T->y[b], T->x[c], T->y[c]);
+}
+
+// > 0 se d está dentro do círculo de a, b, c (em sentido anti-horário)
+static double incirculo(TriangulacaoStruct *T, int a, int b, int c, int d) {
+    double adx = T->x[a] - T->x[d], ady = T->y[a] - T->y[d];
+    double bdx = T->x[b] - T->x[d], bdy = T->y[b] - T->y[d];
+    double cdx = T->x[c] - T->x[d], cdy = T->y[c] - T->y[d];
+    double ad = adx * adx + ady * ady;
+    double bd = bdx * bdx + bdy * bdy;
+    double cd = cdx * cdx + cdy * cdy;
+    return adx * (bdy * cd - bd * cdy) - ady * (bdx * cd - bd * cdx) + ad * (bdx * cdy - bdy * cdx);
+}
+
+static int adicionaVertice(TriangulacaoStruct *T, double x, double y) {
+    if (T->qtdVert >= T->capVert) {
+        T->capVert = (T->capVert == 0) ? 64 : T->capVert * 2;
+        T->x = realloc(T->x, T->capVert * sizeof(double));
+        T->y = realloc(T->y, T->capVert * sizeof(double));
+        T->triDoVertice = realloc(T->triDoVertice, T->capVert * sizeof(int));
+    }
+    T->x[T->qtdVert] = x;
+    T->y[T->qtdVert] = y;
+    T->triDoVertice[T->qtdVert] = -1;
+    return T->qtdVert++;
+}
+
+static int novoTriangulo(TriangulacaoStruct *T) {
+    if (T->qtdTri >= T->capTri) {
+        T->capTri = (T->capTri == 0) ? 128 : T->capTri * 2;
+        T->tri = realloc(T->tri, T->capTri * sizeof(Triangulo));
+    }
+    return T->qtdTri++;
+}
+
+static void defineTriangulo(TriangulacaoStruct *T, int t, int a, int b, int c,
+                            int na, int nb, int nc, bool ra, bool rb, bool rc) {
+    Triangulo *tr = &T->tri[t];
+    tr->v[0] = a; tr->v[1] = b; tr->v[2] = c;
+    tr->viz[0] = na; tr->viz[1] = nb; tr->viz[2] = nc;
+    tr->restrita[0] = ra; tr->restrita[1] = rb; tr->restrita[2] = rc;
+    T->triDoVertice[a] = t;
+    T->triDoVertice[b] = t;
+    T->triDoVertice[c] = t;
+}
+
+// O vizinho u passa a apontar para 'novo' onde apontava para 'antigo'
+static void trocaVizinho(TriangulacaoStruct *T, int u, int antigo, int novo) {
+    if (u < 0) return;
+    for (int k = 0; k < 3; k++) {
+        if (T->tri[u].viz[k] == antigo) {
+            T->tri[u].viz[k] = novo;
+            return;
+        }
+    }
+}
+
+static int indiceVizinho(TriangulacaoStruct *T, int t, int u) {
+    for (int k = 0; k < 3; k++) {
+        if (T->tri[t].viz[k] == u) return k;
+    }
+    return -1;
+}
+
+static int indiceVertice(TriangulacaoStruct *T, int t, int v) {
+    for (int k = 0; k < 3; k++) {
+        if (T->tri[t].v[k] == v) return k;
+    }
+    return -1;
+}
+
+/*
+ * Troca a diagonal do quadrilátero formado por t e o vizinho oposto a v[i].
+ * t = (p, a, b) e u = (q, b, a) viram t = (p, a, q) e u = (p, q, b).
+ */
+static void trocaDiagonal(TriangulacaoStruct *T, int t, int i) {
+    Triangulo *tt = &T->tri[t];
+    int p = tt->v[i], a = tt->v[(i + 1) % 3], b = tt->v[(i + 2) % 3];
+    int nTa = tt->viz[(i + 1) % 3];  bool rTa = tt->restrita[(i + 1) % 3];   // aresta (b, p)
+    int nTb = tt->viz[(i + 2) % 3];  bool rTb = tt->restrita[(i + 2) % 3];   // aresta (p, a)
+
+    int u = tt->viz[i];
+    int j = indiceVizinho(T, u, t);
+    Triangulo *uu = &T->tri[u];
+    int q = uu->v[j];
+    int nUb = uu->viz[(j + 1) % 3];  bool rUb = uu->restrita[(j + 1) % 3];   // aresta (a, q)
+    int nUa = uu->viz[(j + 2) % 3];  bool rUa = uu->restrita[(j + 2) % 3];   // aresta (q, b)
+
+    defineTriangulo(T, t, p, a, q, nUb, u, nTb, rUb, false, rTb);
+    defineTriangulo(T, u, p, q, b, nUa, nTa, t, rUa, rTa, false);
+    trocaVizinho(T, nUb, u, t);
+    trocaVizinho(T, nTa, t, u);
+}
+
+// Restaura a condição de Delaunay em volta do vértice recém-inserido
+static void legaliza(TriangulacaoStruct *T, VetorInt *pilha) {
+    while (pilha->qtd >= 2) {
+        int i = pilha->v[--pilha->qtd];
+        int t = pilha->v[--pilha->qtd];
+        Triangulo *tt = &T->tri[t];
+        int u = tt->viz[i];
+        if (u < 0 || tt->restrita[i]) continue;
+
+        int j = indiceVizinho(T, u, t);
+        int q = T->tri[u].v[j];
+        if (incirculo(T, tt->v[0], tt->v[1], tt->v[2], q) > 0.0) {
+            trocaDiagonal(T, t, i);
+            empilhaInt(pilha, t); empilhaInt(pilha, 0);
+            empilhaInt(pilha, u); empilhaInt(pilha, 0);
+        }
+    }
+}
+
+// Vértice p estritamente dentro de t = (a, b, c): três triângulos (p, ...)
+static void insereNoTriangulo(TriangulacaoStruct *T, int t, int p, VetorInt *pilha) {
+    Triangulo velho = T->tri[t];
+    int a = velho.v[0], b = velho.v[1], c = velho.v[2];
+    int t1 = novoTriangulo(T);
+    int t2 = novoTriangulo(T);
+
+    defineTriangulo(T, t,  p, b, c, velho.viz[0], t1, t2, velho.restrita[0], false, false);
+    defineTriangulo(T, t1, p, c, a, velho.viz[1], t2, t,  velho.restrita[1], false, false);
+    defineTriangulo(T, t2, p, a, b, velho.viz[2], t,  t1, velho.restrita[2], false, false);
+    trocaVizinho(T, velho.viz[1], t, t1);
+    trocaVizinho(T, velho.viz[2], t, t2);
+
+    empilhaInt(pilha, t);  empilhaInt(pilha, 0);
+    empilhaInt(pilha, t1); empilhaInt(pilha, 0);
+    empilhaInt(pilha, t2); empilhaInt(pilha, 0);
+}
+
+// Vértice p sobre a aresta oposta a v[i] de t: divide t e o vizinho em dois cada
+static void insereNaAresta(TriangulacaoStruct *T, int t, int i, int p, VetorInt *pilha) {
+    Triangulo velhoT = T->tri[t];
+    int c = velhoT.v[i], a = velhoT.v[(i + 1) % 3], b = velhoT.v[(i + 2) % 3];
+    int nTa = velhoT.viz[(i + 1) % 3];  bool rTa = velhoT.restrita[(i + 1) % 3];   // aresta (b, c)
+    int nTb = velhoT.viz[(i + 2) % 3];  bool rTb = velhoT.restrita[(i + 2) % 3];   // aresta (c, a)
+    bool rAB = velhoT.restrita[i];
+    int u = velhoT.viz[i];
+
+    int tB = novoTriangulo(T);
+    if (u < 0) {
+        defineTriangulo(T, t,  p, c, a, nTb, -1, tB, rTb, rAB, false);
+        defineTriangulo(T, tB, p, b, c, nTa, t, -1,  rTa, false, rAB);
+        trocaVizinho(T, nTa, t, tB);
+        empilhaInt(pilha, t);  empilhaInt(pilha, 0);
+        empilhaInt(pilha, tB); empilhaInt(pilha, 0);
+        return;
+    }
+
+    Triangulo velhoU = T->tri[u];
+    int j = indiceVizinho(T, u, t);
+    int d = velhoU.v[j];
+    int nUb = velhoU.viz[(j + 1) % 3];  bool rUb = velhoU.restrita[(j + 1) % 3];   // aresta (a, d)
+    int nUa = velhoU.viz[(j + 2) % 3];  bool rUa = velhoU.restrita[(j + 2) % 3];   // aresta (d, b)
+    int tD = novoTriangulo(T);
+
+    defineTriangulo(T, t,  p, c, a, nTb, u,  tB, rTb, rAB, false);
+    defineTriangulo(T, tB, p, b, c, nTa, t,  tD, rTa, false, rAB);
+    defineTriangulo(T, u,  p, a, d, nUb, tD, t,  rUb, false, rAB);
+    defineTriangulo(T, tD, p, d, b, nUa, tB, u,  rUa, rAB, false);
+    trocaVizinho(T, nTa, t, tB);
+    trocaVizinho(T, nUa, u, tD);
+
+    empilhaInt(pilha, t);  empilhaInt(pilha, 0);
+    empilhaInt(pilha, tB); empilhaInt(pilha, 0);
+    empilhaInt(pilha, u);  empilhaInt(pilha, 0);
+    empilhaInt(pilha, tD); empilhaInt(pilha, 0);
+}
+
+/*
+ * Localiza (x, y) andando pelos vizinhos a partir de 'inicio'.
+ * Retorna o triângulo (-1 se fora do domínio); *vertice recebe o vértice
+ * coincidente (ou -1) e *aresta o índice da aresta que contém o ponto (ou -1).
+ */
+static int localiza(TriangulacaoStruct *T, int inicio, double x, double y, int *vertice, int *aresta) {
+    int t = inicio;
+    int limite = T->qtdTri + 16;
+    *vertice = -1;
+    *aresta = -1;
+
+    for (int passo = 0; passo < limite && t >= 0; passo++) {
+        Triangulo *tr = &T->tri[t];
+        int prox = -2;
+        for (int k = 0; k < 3; k++) {
+            int e = (k + passo) % 3;   // varia a ordem para não andar em círculos
+            int a = tr->v[(e + 1) % 3], b = tr->v[(e + 2) % 3];
+            if (orient2d(T->x[a], T->y[a], T->x[b], T->y[b], x, y) < 0.0) {
+                prox = tr->viz[e];
+                break;
+            }
+        }
+        if (prox == -2) {
+            for (int k = 0; k < 3; k++) {
+                int v = tr->v[k];
+                if (fabs(T->x[v] - x) <= T->tol && fabs(T->y[v] - y) <= T->tol) {
+                    *vertice = v;
+                    return t;
+                }
+            }
+            for (int e = 0; e < 3; e++) {
+                int a = tr->v[(e + 1) % 3], b = tr->v[(e + 2) % 3];
+                double comp = hypot(T->x[b] - T->x[a], T->y[b] - T->y[a]);
+                if (fabs(orient2d(T->x[a], T->y[a], T->x[b], T->y[b], x, y)) <= T->tol * comp) {
+                    *aresta = e;
+                    break;
+                }
+            }
+            return t;
+        }
+        t = prox;
+    }
+
+    if (t < 0) return -1;
+
+    // Caminhada não convergiu (caso degenerado): busca linear
+    for (int i = 0; i < T->qtdTri; i++) {
+        Triangulo *tr = &T->tri[i];
+        if (orient2d(T->x[tr->v[0]], T->y[tr->v[0]], T->x[tr->v[1]], T->y[tr->v[1]], x, y) >= 0.0 &&
+            orient2d(T->x[tr->v[1]], T->y[tr->v[1]], T->x[tr->v[2]], T->y[tr->v[2]], x, y) >= 0.0 &&
+            orient2d(T->x[tr->v[2]], T->y[tr->v[2]], T->x[tr->v[0]], T->y[tr->v[0]], x, y) >= 0.0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Insere o ponto; retorna o vértice (novo ou coincidente), ou -1 se fora do domínio
+static int inserePonto(TriangulacaoStruct *T, double x, double y, int *ultimo, VetorInt *pilha) {
+    int vertice, aresta;
+    int t = localiza(T, *ultimo, x, y, &vertice, &aresta);
+    if (t < 0) return -1;
+    *ultimo = t;
+    if (vertice >= 0) return vertice;
+
+    int p = adicionaVertice(T, x, y);
+    if (aresta >= 0) {
+        insereNaAresta(T, t, aresta, p, pilha);
+    } else {
+        insereNoTriangulo(T, t, p, pilha);
+    }
+    legaliza(T, pilha);
+    *ultimo = T->triDoVertice[p];
+    return p;
+}
+
+// Triângulos em volta do vértice v (nos dois sentidos, parando nas bordas)
+static void trianguloEmVolta(TriangulacaoStruct *T, int v, VetorInt *saida) {
+    saida->qtd = 0;
+    int t0 = T->triDoVertice[v];
+    if (t0 < 0) return;
+
+    int t = t0;
+    do {
+        empilhaInt(saida, t);
+        int k = indiceVertice(T, t, v);
+        t = T->tri[t].viz[(k + 2) % 3];
+    } while (t >= 0 && t != t0);
+
+    if (t == t0) return;
+
+    t = T->tri[t0].viz[(indiceVertice(T, t0, v) + 1) % 3];
+    while (t >= 0 && t != t0) {
+        empilhaInt(saida, t);
+        int k = indiceVertice(T, t, v);
+        t = T->tri[t].viz[(k + 1) % 3];
+    }
+}
+
+// Acha a aresta (a, b): triângulo e índice do vértice oposto
+static bool achaAresta(TriangulacaoStruct *T, int a, int b, VetorInt *aux, int *tOut, int *iOut) {
+    trianguloEmVolta(T, a, aux);
+    for (int n = 0; n < aux->qtd; n++) {
+        int t = aux->v[n];
+        int k = indiceVertice(T, t, a);
+        if (T->tri[t].v[(k + 1) % 3] == b) { *tOut = t; *iOut = (k + 2) % 3; return true; }
+        if (T->tri[t].v[(k + 2) % 3] == b) { *tOut = t; *iOut = (k + 1) % 3; return true; }
+    }
+    return false;
+}
+
+static void marcaRestrita(TriangulacaoStruct *T, int t, int i) {
+    if (!T->tri[t].restrita[i]) T->qtdRestritas++;
+    T->tri[t].restrita[i] = true;
+    int u = T->tri[t].viz[i];
+    if (u >= 0) {
+        T->tri[u].restrita[indiceVizinho(T, u, t)] = true;
+    }
+}
+
+// p está sobre o segmento aberto (a, b)?
+static bool entreColinear(TriangulacaoStruct *T, int a, int b, int p) {
+    double dx = T->x[b] - T->x[a], dy = T->y[b] - T->y[a];
+    double s = ((T->x[p] - T->x[a]) * dx + (T->y[p] - T->y[a]) * dy) / (dx * dx + dy * dy);
+    return s > 0.0 && s < 1.0;
+}
+
+static bool colinear(TriangulacaoStruct *T, int a, int b, int p) {
+    double comp = hypot(T->x[b] - T->x[a], T->y[b] - T->y[a]);
+    return fabs(orientV(T, a, b, p)) <= T->tol * comp;
+}
+
+/*
+ * Insere a aresta restrita (a, b) trocando as diagonais que a cruzam
+ * (algoritmo de Sloan). Se algum vértice estiver sobre (a, b), a aresta
+ * é dividida nele e os pedaços vão para 'pendentes'.
+ */
+static void insereRestricao(TriangulacaoStruct *T, int a, int b, VetorInt *pendentes, VetorInt *aux, VetorInt *cruzadas) {
+    int t, i;
+    if (a == b) return;
+    if (achaAresta(T, a, b, aux, &t, &i)) {
+        marcaRestrita(T, t, i);
+        return;
+    }
+
+    // 1. Triângulo em volta de 'a' por onde o segmento sai
+    trianguloEmVolta(T, a, aux);
+    int tAtual = -1, kAtual = -1;
+    for (int n = 0; n < aux->qtd; n++) {
+        int tt = aux->v[n];
+        int k = indiceVertice(T, tt, a);
+        int p1 = T->tri[tt].v[(k + 1) % 3], p2 = T->tri[tt].v[(k + 2) % 3];
+        if (colinear(T, a, b, p1) && entreColinear(T, a, b, p1)) {
+            empilhaInt(pendentes, a); empilhaInt(pendentes, p1);
+            empilhaInt(pendentes, p1); empilhaInt(pendentes, b);
+            return;
+        }
+        if (orientV(T, a, p1, b) > 0.0 && orientV(T, a, p2, b) < 0.0) {
+            tAtual = tt;
+            kAtual = k;
+            break;
+        }
+    }
+    if (tAtual < 0) {
+        fprintf(stderr, "Aviso: triangulacao nao encontrou o segmento (%d, %d).\n", a, b);
+        return;
+    }
+
+    // 2. Caminha ao longo de (a, b) guardando as arestas cruzadas (esq, dir)
+    cruzadas->qtd = 0;
+    cruzadas->ini = 0;
+    int dir = T->tri[tAtual].v[(kAtual + 1) % 3];
+    int esq = T->tri[tAtual].v[(kAtual + 2) % 3];
+    while (true) {
+        empilhaInt(cruzadas, esq);
+        empilhaInt(cruzadas, dir);
+
+        int u = T->tri[tAtual].viz[kAtual];
+        if (u < 0) {
+            fprintf(stderr, "Aviso: segmento (%d, %d) sai do dominio da triangulacao.\n", a, b);
+            return;
+        }
+        int j = indiceVizinho(T, u, tAtual);
+        int w = T->tri[u].v[j];
+        if (w == b) break;
+
+        if (colinear(T, a, b, w)) {
+            empilhaInt(pendentes, a); empilhaInt(pendentes, w);
+            empilhaInt(pendentes, w); empilhaInt(pendentes, b);
+            return;
+        }
+        if (orientV(T, a, b, w) > 0.0) {
+            esq = w;
+            kAtual = indiceVertice(T, u, dir == T->tri[u].v[(j + 1) % 3] ? T->tri[u].v[(j + 2) % 3] : T->tri[u].v[(j + 1) % 3]);
+        } else {
+            dir = w;
+            kAtual = indiceVertice(T, u, esq == T->tri[u].v[(j + 1) % 3] ? T->tri[u].v[(j + 2) % 3] : T->tri[u].v[(j + 1) % 3]);
+        }
+        tAtual = u;
+    }
+
+    // 3. Troca as diagonais cruzadas até (a, b) aparecer
+    long limite = 64L * (cruzadas->qtd + 16) * (cruzadas->qtd + 16);
+    for (long it = 0; cruzadas->ini < cruzadas->qtd; it++) {
+        if (it > limite) {
+            fprintf(stderr, "Aviso: triangulacao desistiu do segmento (%d, %d).\n", a, b);
+            return;
+        }
+        int x = cruzadas->v[cruzadas->ini++];
+        int y = cruzadas->v[cruzadas->ini++];
+        if (!achaAresta(T, x, y, aux, &t, &i)) continue;
+
+        int u = T->tri[t].viz[i];
+        if (u < 0) continue;
+        int p = T->tri[t].v[i];
+        int q = T->tri[u].v[indiceVizinho(T, u, t)];
+
+        double ox = orientV(T, p, q, x), oy = orientV(T, p, q, y);
+        bool convexo = (ox > 0.0 && oy < 0.0) || (ox < 0.0 && oy > 0.0);
+        if (!convexo) {
+            empilhaInt(cruzadas, x);
+            empilhaInt(cruzadas, y);
+            continue;
+        }
+
+        trocaDiagonal(T, t, i);
+        if (p != a && p != b && q != a && q != b) {
+            double op = orientV(T, a, b, p), oq = orientV(T, a, b, q);
+            if ((op > 0.0 && oq < 0.0) || (op < 0.0 && oq > 0.0)) {
+                empilhaInt(cruzadas, p);
+                empilhaInt(cruzadas, q);
+            }
+        }
+    }
+
+    if (achaAresta(T, a, b, aux, &t, &i)) {
+        marcaRestrita(T, t, i);
+    }
+}
+
+/*________________________________ PRÉ-PROCESSAMENTO DOS SEGMENTOS ________________________________*/
+
+typedef struct {
+    double x, y;
+    double s;       // posição ao longo do segmento (0 a 1)
+    int seg;
+    int vertice;
+} PontoSeg;
+
+typedef struct {
+    PontoSeg *v;
+    int qtd, cap;
+} VetorPontos;
+
+static void adicionaPontoSeg(VetorPontos *p, double x, double y, double s, int seg) {
+    if (p->qtd >= p->cap) {
+        p->cap = (p->cap == 0) ? 256 : p->cap * 2;
+        p->v = realloc(p->v, p->cap * sizeof(PontoSeg));
+    }
+    PontoSeg *ps = &p->v[p->qtd++];
+    ps->x = x;
+    ps->y = y;
+    ps->s = s;
+    ps->seg = seg;
+    ps->vertice = -1;
+}
+
+static int compararPorX(const void *a, const void *b) {
+    const PontoSeg *p = (const PontoSeg*) a;
+    const PontoSeg *q = (const PontoSeg*) b;
+    if (p->x < q->x) return -1;
+    if (p->x > q->x) return 1;
+    if (p->y < q->y) return -1;
+    if (p->y > q->y) return 1;
+    return 0;
+}
+
+static int compararPorSegmento(const void *a, const void *b) {
+    const PontoSeg *p = (const PontoSeg*) a;
+    const PontoSeg *q = (const PontoSeg*) b;
+    if (p->seg != q->seg) return p->seg - q->seg;
+    if (p->s < q->s) return -1;
+    if (p->s > q->s) return 1;
+    return 0;
+}
+
+// Índice do segmento com a chave de ordenação ao lado, para o comparador
+// não depender de estado global (triangulações podem rodar em paralelo)
+typedef struct {
+    double minX;
+    int indice;
+} SegmentoPorX;
+
+static int compararMinX(const void *a, const void *b) {
+    const SegmentoPorX *s1 = (const SegmentoPorX*) a;
+    const SegmentoPorX *s2 = (const SegmentoPorX*) b;
+    if (s1->minX < s2->minX) return -1;
+    if (s1->minX > s2->minX) return 1;
+    return (s1->indice > s2->indice) - (s1->indice < s2->indice);
+}
+
+// Posição de (x, y) ao longo do segmento s
+static double parametro(const double *s, double x, double y) {
+    double dx = s[2] - s[0], dy = s[3] - s[1];
+    return ((x - s[0]) * dx + (y - s[1]) * dy) / (dx * dx + dy * dy);
+}
+
+/*
+ * Pontos de quebra: extremidades, cruzamentos e extremidades que tocam
+ * outro segmento. Poda pelo intervalo em x (segmentos ordenados por x mínimo).
+ */
+static void pontosDeQuebra(const double *segs, const int *validos, int qtd, double tol, VetorPontos *pontos) {
+    SegmentoPorX *ordem = malloc(qtd * sizeof(SegmentoPorX));
+    for (int n = 0; n < qtd; n++) {
+        const double *s = &segs[4 * validos[n]];
+        ordem[n].minX = fmin(s[0], s[2]);
+        ordem[n].indice = validos[n];
+    }
+    qsort(ordem, qtd, sizeof(SegmentoPorX), compararMinX);
+
+    for (int n = 0; n < qtd; n++) {
+        const double *s = &segs[4 * validos[n]];
+        adicionaPontoSeg(pontos, s[0], s[1], 0.0, validos[n]);
+        adicionaPontoSeg(pontos, s[2], s[3], 1.0, validos[n]);
+    }
+
+    for (int n = 0; n < qtd; n++) {
+        int i = ordem[n].indice;
+        const double *a = &segs[4 * i];
+        double maxXi = fmax(a[0], a[2]);
+        double minYi = fmin(a[1], a[3]), maxYi = fmax(a[1], a[3]);
+        double compA = hypot(a[2] - a[0], a[3] - a[1]);
+
+        for (int m = n + 1; m < qtd; m++) {
+            int j = ordem[m].indice;
+            const double *b = &segs[4 * j];
+            if (fmin(b[0], b[2]) > maxXi + tol) break;
+            if (fmin(b[1], b[3]) > maxYi + tol || fmax(b[1], b[3]) < minYi - tol) continue;
+
+            double compB = hypot(b[2] - b[0], b[3] - b[1]);
+            double d1 = orient2d(a[0], a[1], a[2], a[3], b[0], b[1]);
+            double d2 = orient2d(a[0], a[1], a[2], a[3], b[2], b[3]);
+            double d3 = orient2d(b[0], b[1], b[2], b[3], a[0], a[1]);
+            double d4 = orient2d(b[0], b[1], b[2], b[3], a[2], a[3]);
+            bool z1 = fabs(d1) <= tol * compA, z2 = fabs(d2) <= tol * compA;
+            bool z3 = fabs(d3) <= tol * compB, z4 = fabs(d4) <= tol * compB;
+
+            if (!z1 && !z2 && !z3 && !z4 && (d1 > 0) != (d2 > 0) && (d3 > 0) != (d4 > 0)) {
+                // Cruzamento próprio
+                double s = d3 / (d3 - d4);
+                double x = a[0] + s * (a[2] - a[0]);
+                double y = a[1] + s * (a[3] - a[1]);
+                adicionaPontoSeg(pontos, x, y, s, i);
+                adicionaPontoSeg(pontos, x, y, parametro(b, x, y), j);
+                continue;
+            }
+
+            // Extremidade de um segmento sobre o interior do outro
+            double sb1 = parametro(a, b[0], b[1]), sb2 = parametro(a, b[2], b[3]);
+            double sa1 = parametro(b, a[0], a[1]), sa2 = parametro(b, a[2], a[3]);
+            if (z1 && sb1 > 0.0 && sb1 < 1.0) adicionaPontoSeg(pontos, b[0], b[1], sb1, i);
+            if (z2 && sb2 > 0.0 && sb2 < 1.0) adicionaPontoSeg(pontos, b[2], b[3], sb2, i);
+            if (z3 && sa1 > 0.0 && sa1 < 1.0) adicionaPontoSeg(pontos, a[0], a[1], sa1, j);
+            if (z4 && sa2 > 0.0 && sa2 < 1.0) adicionaPontoSeg(pontos, a[2], a[3], sa2, j);
+        }
+    }
+
+    free(ordem);
+}
+
+/*________________________________ FUNÇÕES PÚBLICAS ________________________________*/
+
+Triangulacao criaTriangulacao(const double *segmentos, int qtdSegmentos) {
+    TriangulacaoStruct *T = calloc(1, sizeof(TriangulacaoStruct));
+    if (T == NULL) {
+        fprintf(stderr, "Erro: falha ao alocar triangulacao.\n");
+        return NULL;
+    }
+
+    // Extensão da cena e segmentos não degenerados
+    double minX = 0.0, minY = 0.0, maxX = 1.0, maxY = 1.0;
+    for (int i = 0; i < qtdSegmentos; i++) {
+        const double *s = &segmentos[4 * i];
+        for (int k = 0; k < 4; k += 2) {
+            if (i == 0 && k == 0) { minX = maxX = s[0]; minY = maxY = s[1]; }
+            minX = fmin(minX, s[k]);  maxX = fmax(maxX, s[k]);
+            minY = fmin(minY, s[k + 1]);  maxY = fmax(maxY, s[k + 1]);
+        }
+    }
+    double extensao = fmax(fmax(maxX - minX, maxY - minY), 1.0);
+    T->tol = TOLERANCIA_RELATIVA * extensao;
+
+    int *validos = malloc((qtdSegmentos > 0 ? qtdSegmentos : 1) * sizeof(int));
+    int qtdValidos = 0;
+    for (int i = 0; i < qtdSegmentos; i++) {
+        const double *s = &segmentos[4 * i];
+        if (hypot(s[2] - s[0], s[3] - s[1]) > T->tol) validos[qtdValidos++] = i;
+    }
+
+    // Caixa do domínio: dois triângulos
+    double folga = FOLGA_DOMINIO * extensao;
+    T->minX = minX - folga;  T->maxX = maxX + folga;
+    T->minY = minY - folga;  T->maxY = maxY + folga;
+    int c0 = adicionaVertice(T, T->minX, T->minY);
+    int c1 = adicionaVertice(T, T->maxX, T->minY);
+    int c2 = adicionaVertice(T, T->maxX, T->maxY);
+    int c3 = adicionaVertice(T, T->minX, T->maxY);
+    int t0 = novoTriangulo(T);
+    int t1 = novoTriangulo(T);
+    defineTriangulo(T, t0, c0, c1, c2, -1, t1, -1, false, false, false);
+    defineTriangulo(T, t1, c0, c2, c3, -1, -1, t0, false, false, false);
+
+    // Pontos de quebra dos segmentos, inseridos como vértices
+    VetorPontos pontos = {0};
+    pontosDeQuebra(segmentos, validos, qtdValidos, T->tol, &pontos);
+
+    qsort(pontos.v, pontos.qtd, sizeof(PontoSeg), compararPorX);
+    VetorInt pilha = {0};
+    int ultimo = t0;
+    for (int n = 0; n < pontos.qtd; n++) {
+        PontoSeg *p = &pontos.v[n];
+        // Ponto igual a um anterior (mesmo x e y dentro da tolerância)
+        for (int m = n - 1; m >= 0 && pontos.v[n].x - pontos.v[m].x <= T->tol; m--) {
+            if (fabs(pontos.v[m].y - p->y) <= T->tol) {
+                p->vertice = pontos.v[m].vertice;
+                break;
+            }
+        }
+        if (p->vertice < 0) {
+            p->vertice = inserePonto(T, p->x, p->y, &ultimo, &pilha);
+        }
+    }
+
+    // Pedaços de cada segmento entre pontos de quebra consecutivos
+    qsort(pontos.v, pontos.qtd, sizeof(PontoSeg), compararPorSegmento);
+    VetorInt pendentes = {0}, aux = {0}, cruzadas = {0};
+    for (int n = 0; n + 1 < pontos.qtd; n++) {
+        PontoSeg *p = &pontos.v[n], *q = &pontos.v[n + 1];
+        if (p->seg != q->seg || p->vertice == q->vertice || p->vertice < 0 || q->vertice < 0) continue;
+
+        empilhaInt(&pendentes, p->vertice);
+        empilhaInt(&pendentes, q->vertice);
+        while (pendentes.qtd >= 2) {
+            int b = pendentes.v[--pendentes.qtd];
+            int a = pendentes.v[--pendentes.qtd];
+            insereRestricao(T, a, b, &pendentes, &aux, &cruzadas);
+        }
+    }
+
+    free(pendentes.v);
+    free(aux.v);
+    free(cruzadas.v);
+    free(pilha.v);
+    free(pontos.v);
+    free(validos);
+    return (Triangulacao) T;
+}
+
+void destroiTriangulacao(Triangulacao t) {
+    if (t == NULL) {
+        return;
+    }
+    TriangulacaoStruct *T = (TriangulacaoStruct*) t;
+    free(T->x);
+    free(T->y);
+    free(T->triDoVertice);
+    free(T->tri);
+    free(T);
+}
+
+/*________________________________ EXPANSÃO TRIANGULAR ________________________________*/
+
+// Cone de visão: atravessar a aresta oposta a v[i] de t, entre as direções R e L
+typedef struct {
+    int t, i;
+    double rx, ry;      // ponto na direção da borda direita do cone
+    double lx, ly;      // ponto na direção da borda esquerda
+} Cone;
+
+typedef struct {
+    double *xs, *ys;
+    int qtd, cap;
+} Saida;
+
+static void emite(Saida *s, double x, double y, double tol) {
+    if (s->qtd > 0 && fabs(s->xs[s->qtd - 1] - x) <= tol && fabs(s->ys[s->qtd - 1] - y) <= tol) {
+        return;
+    }
+    if (s->qtd >= s->cap) {
+        s->cap = (s->cap == 0) ? 64 : s->cap * 2;
+        s->xs = realloc(s->xs, s->cap * sizeof(double));
+        s->ys = realloc(s->ys, s->cap * sizeof(double));
+    }
+    s->xs[s->qtd] = x;
+    s->ys[s->qtd] = y;
+    s->qtd++;
+}
+
+// Interseção do raio q->d com a reta da aresta (e1, e2)
+static void raioAresta(TriangulacaoStruct *T, double qx, double qy, double dx, double dy, int e1, int e2, double *x, double *y) {
+    double ax = T->x[e1], ay = T->y[e1], bx = T->x[e2], by = T->y[e2];
+    if (dx == ax && dy == ay) { *x = ax; *y = ay; return; }
+    if (dx == bx && dy == by) { *x = bx; *y = by; return; }
+
+    double ex = bx - ax, ey = by - ay;
+    double rx = dx - qx, ry = dy - qy;
+    double den = rx * ey - ry * ex;
+    if (fabs(den) < 1e-300) { *x = ax; *y = ay; return; }
+    double s = ((ax - qx) * ey - (ay - qy) * ex) / den;
+    *x = qx + s * rx;
+    *y = qy + s * ry;
+}
+
+int visibilidadeTriangulacao(Triangulacao tri, double qx, double qy, double **xs, double **ys) {
+    *xs = NULL;
+    *ys = NULL;
+    if (tri == NULL) return -1;
+
+    TriangulacaoStruct *T = (TriangulacaoStruct*) tri;
+    if (qx <= T->minX || qx >= T->maxX || qy <= T->minY || qy >= T->maxY) {
+        return -1;
+    }
+
+    int vertice, aresta;
+    int t = localiza(T, 0, qx, qy, &vertice, &aresta);
+    if (t < 0) return -1;
+
+    // Observador sobre vértice ou aresta: desloca-o de leve para dentro do triângulo
+    if (vertice >= 0 || aresta >= 0) {
+        Triangulo *tr = &T->tri[t];
+        double cx = (T->x[tr->v[0]] + T->x[tr->v[1]] + T->x[tr->v[2]]) / 3.0;
+        double cy = (T->y[tr->v[0]] + T->y[tr->v[1]] + T->y[tr->v[2]]) / 3.0;
+        double d = hypot(cx - qx, cy - qy);
+        double passo = fmin(100.0 * T->tol, 0.5 * d);
+        qx += (cx - qx) / d * passo;
+        qy += (cy - qy) / d * passo;
+    }
+
+    Saida saida = {0};
+    Cone *cones = NULL;
+    int capCones = 0, qtdCones = 0;
+
+    // Arestas do triângulo inicial em sentido anti-horário, a partir de (v0, v1)
+    Triangulo *tr = &T->tri[t];
+    int ordem[3] = {1, 0, 2};   // empilhadas ao contrário: saem 2, 0, 1
+    for (int n = 0; n < 3; n++) {
+        int i = ordem[n];
+        if (qtdCones >= capCones) {
+            capCones = (capCones == 0) ? 64 : capCones * 2;
+            cones = realloc(cones, capCones * sizeof(Cone));
+        }
+        Cone *c = &cones[qtdCones++];
+        c->t = t;
+        c->i = i;
+        c->rx = T->x[tr->v[(i + 1) % 3]];  c->ry = T->y[tr->v[(i + 1) % 3]];
+        c->lx = T->x[tr->v[(i + 2) % 3]];  c->ly = T->y[tr->v[(i + 2) % 3]];
+    }
+
+    while (qtdCones > 0) {
+        Cone c = cones[--qtdCones];
+        Triangulo *tc = &T->tri[c.t];
+        int e1 = tc->v[(c.i + 1) % 3], e2 = tc->v[(c.i + 2) % 3];
+        int u = tc->viz[c.i];
+
+        if (u < 0 || tc->restrita[c.i]) {
+            double x, y;
+            raioAresta(T, qx, qy, c.rx, c.ry, e1, e2, &x, &y);
+            emite(&saida, x, y, T->tol);
+            raioAresta(T, qx, qy, c.lx, c.ly, e1, e2, &x, &y);
+            emite(&saida, x, y, T->tol);
+            continue;
+        }
+
+        int j = indiceVizinho(T, u, c.t);
+        int w = T->tri[u].v[j];
+        double wx = T->x[w], wy = T->y[w];
+        double oR = orient2d(qx, qy, c.rx, c.ry, wx, wy);
+        double oL = orient2d(qx, qy, c.lx, c.ly, wx, wy);
+
+        if (qtdCones + 2 > capCones) {
+            capCones = (capCones == 0) ? 64 : capCones * 2;
+            cones = realloc(cones, capCones * sizeof(Cone));
+        }
+
+        // Sub-cones pelas arestas (w, e2) à esquerda e (e1, w) à direita;
+        // a da direita é empilhada por último para sair primeiro
+        if (oR <= 0.0) {
+            cones[qtdCones++] = (Cone){u, (j + 2) % 3, c.rx, c.ry, c.lx, c.ly};
+        } else if (oL >= 0.0) {
+            cones[qtdCones++] = (Cone){u, (j + 1) % 3, c.rx, c.ry, c.lx, c.ly};
+        } else {
+            cones[qtdCones++] = (Cone){u, (j + 2) % 3, wx, wy, c.lx, c.ly};
+            cones[qtdCones++] = (Cone){u, (j + 1) % 3, c.rx, c.ry, wx, wy};
+        }
+    }
+
+    // O polígono é fechado: o último ponto pode repetir o primeiro
+    if (saida.qtd > 1 && fabs(saida.xs[0] - saida.xs[saida.qtd - 1]) <= T->tol &&
+        fabs(saida.ys[0] - saida.ys[saida.qtd - 1]) <= T->tol) {
+        saida.qtd--;
+    }
+
+    free(cones);
+    *xs = saida.xs;
+    *ys = saida.ys;
+    return saida.qtd;
+}
+
+int getQtdTriangulos(Triangulacao t) {
+    if (t == NULL) return 0;
+    return ((TriangulacaoStruct*) t)->qtdTri;
+}
+
+int getQtdArestasRestritas(Triangulacao t) {
+    if (t == NULL) return 0;
+    return ((TriangulacaoStruct*) t)->qtdRestritas;
+}
@@ -0,0 +1,77 @@
+#ifndef TRIANGULACAO_H
+#define TRIANGULACAO_H
+
+/*
+ * TIPO ABSTRATO DE DADOS: TRIANGULAÇÃO RESTRITA DO CENÁRIO
+ *
+ * Pré-processamento para várias consultas de visibilidade sobre o mesmo
+ * conjunto de obstáculos. Os segmentos são quebrados nos pontos em que
+ * se cruzam ou se tocam, e a triangulação de Delaunay dos vértices
+ * resultantes é ajustada (por trocas de diagonais) para conter cada
+ * pedaço de segmento como aresta restrita.
+ *
+ * O domínio é uma caixa que envolve a cena com folga; as bordas da caixa
+ * também bloqueiam a visão.
+ *
+ * A consulta (expansão triangular) parte do triângulo que contém o
+ * observador e atravessa arestas livres, estreitando o cone de visão a
+ * cada triângulo; arestas restritas fecham o cone e viram lados do
+ * polígono. O custo é proporcional aos triângulos visitados mais o
+ * tamanho do polígono, e a triangulação não é alterada pela consulta
+ * (várias threads podem consultar ao mesmo tempo).
+ */
+
+typedef void* Triangulacao;
+
+/*________________________________ FUNÇÕES DE CRIAÇÃO E DESTRUIÇÃO ________________________________*/
+
+/*
+ * Constrói a triangulação restrita dos segmentos.
+ *
+ * segmentos: vetor com 4 doubles por segmento (x1, y1, x2, y2)
+ * qtdSegmentos: número de segmentos
+ *
+ * Pré-condição: segmentos válido se qtdSegmentos > 0
+ * Pós-condição: retorna a triangulação, ou NULL em caso de falha
+ */
+Triangulacao criaTriangulacao(const double *segmentos, int qtdSegmentos);
+
+/*
+ * Libera a triangulação.
+ *
+ * t: ponteiro para a triangulação
+ *
+ * Pré-condição: t deve ser válido ou NULL
+ * Pós-condição: memória liberada
+ */
+void destroiTriangulacao(Triangulacao t);
+
+/*________________________________ CONSULTA ________________________________*/
+
+/*
+ * Calcula o polígono de visibilidade de (qx, qy) por expansão triangular.
+ * Os vértices saem em sentido anti-horário, sem repetições consecutivas.
+ *
+ * t: ponteiro para a triangulação
+ * qx, qy: posição do observador
+ * xs, ys: recebem vetores alocados com as coordenadas (liberar com free)
+ *
+ * Pré-condição: t, xs e ys devem ser válidos
+ * Pós-condição: retorna o número de vértices, ou -1 se (qx, qy) está
+ *               fora do domínio da triangulação (xs e ys ficam NULL)
+ */
+int visibilidadeTriangulacao(Triangulacao t, double qx, double qy, double **xs, double **ys);
+
+/*________________________________ ESTATÍSTICAS ________________________________*/
+
+/*
+ * Retorna o número de triângulos.
+ */
+int getQtdTriangulos(Triangulacao t);
+
+/*
+ * Retorna o número de arestas restritas (pedaços de obstáculos).
+ */
+int getQtdArestasRestritas(Triangulacao t);
+
+#endif
@@ -1,10 +1,16 @@
 #include "visibilidade.h"
-#include "sort.h"
+#include "sort_tipado.h"
+#include "vetortipado.h"
+#include "mergersort.h"
+#include "ordenacao.h"
+#include "radixsort.h"
 #include "formas.h"
 #include "lista.h"
 #include "linha.h"
 #include "retangulo.h" 
 #include "circulo.h" 
+#include "poolthreads.h"
+#include "predicados.h"
 
 #include <math.h>
 #include <stdlib.h>
@@ -18,35 +24,23 @@
 #define HUGE_VAL 1e50
 #endif
 
-// --- DEFINIÇÃO DA STRUCT OPACA ---
-typedef struct stPontoVis {
-    double x;
-    double y;
-} StPontoVis;
-
-// --- IMPLEMENTAÇÃO DOS GETTERS ---
-double getPontoVisX(PontoVis p) {
-    return ((StPontoVis*)p)->x;
-}
-
-double getPontoVisY(PontoVis p) {
-    return ((StPontoVis*)p)->y;
-}
-
 // --- ESTRUTURAS AUXILIARES INTERNAS ---
 typedef struct {
     double x1, y1;
     double x2, y2;
 } SegmentoVar;
 
+VEC_DEFINE(VetorSegmentos, SegmentoVar)
+
 #define EV_INICIO 0
 #define EV_FIM 1
 
+// Evento guardado por valor em um vetor contíguo (16 bytes): a ordenação
+// move os próprios eventos, sem desreferenciar ponteiros a cada comparação
 typedef struct {
     double angulo;
-    int tipo; 
-    double x, y; 
-    SegmentoVar* seg; 
+    int tipo;
+    int seg;        // índice do segmento no vetor de segmentos
 } Evento;
 
 // --- GEOMETRIA BÁSICA ---
@@ -55,6 +49,10 @@ double calcular_angulo(double cy, double cx, double py, double px) {
     return atan2(py - cy, px - cx);
 }
 
+// Interseções mais perto que isto da bomba são ignoradas
+// (segmentos que passam pela própria posição da bomba)
+#define DIST_MIN_RAIO 1e-6
+
 double interseccao_raio_seg(double ox, double oy, double angulo, SegmentoVar* seg) {
     double dx = cos(angulo);
     double dy = sin(angulo);
@@ -62,21 +60,24 @@ double interseccao_raio_seg(double ox, double oy, double angulo, SegmentoVar* se
     double x3 = seg->x1; double y3 = seg->y1;
     double x4 = seg->x2; double y4 = seg->y2;
     
+    // Teste exato: a reta do raio precisa separar (ou tocar) as extremidades.
+    // Substitui o teste 0 <= u <= 1 e o de paralelismo, que usavam tolerância.
+    if (!raioCruzaSegmento(ox, oy, dx, dy, x3, y3, x4, y4)) return HUGE_VAL;
+
     double denom = (x3 - x4)*dy - (y3 - y4)*dx;
-    if (fabs(denom) < 1e-9) return HUGE_VAL; 
+    if (denom == 0.0) return HUGE_VAL;
     
     double t = ((x3 - ox)*(y3 - y4) - (y3 - oy)*(x3 - x4)) / denom;
-    double u = ((x3 - ox)*dy - (y3 - oy)*dx) / denom;
     
-    if (t > 1e-6 && u >= 0.0 && u <= 1.0) {
+    if (t > DIST_MIN_RAIO) {
         return t;
     }
     return HUGE_VAL;
 }
 
 int comparar_eventos(const void* a, const void* b) {
-    Evento* e1 = *(Evento**)a;
-    Evento* e2 = *(Evento**)b;
+    const Evento* e1 = (const Evento*)a;
+    const Evento* e2 = (const Evento*)b;
 
     if (e1->angulo < e2->angulo) return -1;
     if (e1->angulo > e2->angulo) return 1;
@@ -87,27 +88,33 @@ int comparar_eventos(const void* a, const void* b) {
     return 0;
 }
 
-void add_seg(SegmentoVar** arr, int* cap, int* count, double x1, double y1, double x2, double y2) {
-    if (*count >= *cap) {
-        *cap *= 2;
-        *arr = realloc(*arr, (*cap) * sizeof(SegmentoVar));
-    }
-    (*arr)[*count].x1 = x1;
-    (*arr)[*count].y1 = y1;
-    (*arr)[*count].x2 = x2;
-    (*arr)[*count].y2 = y2;
-    (*count)++;
+// Mesma ordem de comparar_eventos, como expressão para o sort tipado
+#define EVENTO_MENOR(a, b) \
+    ((a)->angulo < (b)->angulo || \
+     ((a)->angulo == (b)->angulo && (a)->tipo == EV_INICIO && (b)->tipo == EV_FIM))
+
+SORT_TIPADO_DEFINE(ordenar_eventos_merge, Evento, EVENTO_MENOR)
+
+static inline bool add_seg(VetorSegmentos* v, double x1, double y1, double x2, double y2) {
+    return VetorSegmentos_insere(v, (SegmentoVar) { x1, y1, x2, y2 });
 }
+
+// Segmentos de todos os obstáculos, por valor em um vetor só (liberar com free).
+// Retorna -1 (e *array_segs = NULL) se faltar memória: um segmento a menos
+// daria um polígono errado
 int extrair_segmentos(double bx, double by, Lista formas, SegmentoVar** array_segs) {
-    int capacidade = 100;
-    int count = 0;
-    *array_segs = malloc(capacidade * sizeof(SegmentoVar));
+    VetorSegmentos segs;
+    VetorSegmentos_inicia(&segs);
     (void)bx; (void)by; 
 
-    if (!formas) return 0; // Proteção contra lista nula
+    if (!formas) { // Proteção contra lista nula
+        *array_segs = NULL;
+        return 0;
+    }
 
     int qtd = tamanhoLista(formas);
-    for (int i = 0; i < qtd; i++) {
+    bool ok = VetorSegmentos_reserva(&segs, qtd);
+    for (int i = 0; ok && i < qtd; i++) {
         Forma f = (Forma) getListaPosicao(formas, i);
         
         // --- PROTEÇÃO EXTRA ---
@@ -119,7 +126,7 @@ int extrair_segmentos(double bx, double by, Lista formas, SegmentoVar** array_se
         TipoForma tipo = getFormaTipo(f);
 
         if (tipo == TIPO_LINHA) {
-            add_seg(array_segs, &capacidade, &count, getX1Linha(obj), getY1Linha(obj), getX2Linha(obj), getY2Linha(obj));
+            ok = add_seg(&segs, getX1Linha(obj), getY1Linha(obj), getX2Linha(obj), getY2Linha(obj));
         }
         else if (tipo == TIPO_RETANGULO) {
             double x = getXRetangulo(obj);
@@ -127,56 +134,70 @@ int extrair_segmentos(double bx, double by, Lista formas, SegmentoVar** array_se
             double w = getLarguraRetangulo(obj);
             double h = getAlturaRetangulo(obj);
             
-            add_seg(array_segs, &capacidade, &count, x, y, x+w, y);     
-            add_seg(array_segs, &capacidade, &count, x+w, y, x+w, y+h); 
-            add_seg(array_segs, &capacidade, &count, x+w, y+h, x, y+h); 
-            add_seg(array_segs, &capacidade, &count, x, y+h, x, y);     
+            ok = add_seg(&segs, x, y, x+w, y) &&
+                 add_seg(&segs, x+w, y, x+w, y+h) &&
+                 add_seg(&segs, x+w, y+h, x, y+h) &&
+                 add_seg(&segs, x, y+h, x, y);
         }
     }
-    return count;
+    if (!ok) {
+        VetorSegmentos_libera(&segs);
+        *array_segs = NULL;
+        return -1;
+    }
+    *array_segs = segs.itens;
+    return segs.tamanho;
 }
 
-Lista calcular_visibilidade(double bx, double by, Lista formas, char tipo_sort, int threshold) {
-    SegmentoVar* segs = NULL;
-    int qtd_segs = extrair_segmentos(bx, by, formas, &segs);
-
-    if (qtd_segs == 0) {
-        free(segs);
-        return NULL; // Ou retorna lista vazia
+// Ordena os eventos por radix sort: chave = ângulo, desempate = início antes de fim.
+// Retorna false (eventos intactos) se faltar memória para os buffers.
+static bool ordenar_eventos_radix(Evento* eventos, int qtd_ev) {
+    ParRadix* pares = malloc(qtd_ev * sizeof(ParRadix));
+    Evento* copia = malloc(qtd_ev * sizeof(Evento));
+    if (pares == NULL || copia == NULL) {
+        free(copia);
+        free(pares);
+        return false;
     }
 
-    int qtd_ev = qtd_segs * 2;
-    Evento** eventos = malloc(qtd_ev * sizeof(Evento*));
-    
-    for (int i = 0; i < qtd_segs; i++) {
-        double ang1 = calcular_angulo(by, bx, segs[i].y1, segs[i].x1);
-        double ang2 = calcular_angulo(by, bx, segs[i].y2, segs[i].x2);
-        
-        eventos[2*i] = malloc(sizeof(Evento));
-        eventos[2*i]->angulo = ang1;
-        eventos[2*i]->x = segs[i].x1;
-        eventos[2*i]->y = segs[i].y1;
-        eventos[2*i]->tipo = EV_INICIO; 
-        eventos[2*i]->seg = &segs[i];
+    for (int i = 0; i < qtd_ev; i++) {
+        pares[i].chave = chaveOrdenavelDouble(eventos[i].angulo);
+        pares[i].bitBaixo = (eventos[i].tipo == EV_INICIO) ? 0 : 1;
+        pares[i].indice = i;
+        copia[i] = eventos[i];
+    }
 
-        eventos[2*i+1] = malloc(sizeof(Evento));
-        eventos[2*i+1]->angulo = ang2;
-        eventos[2*i+1]->x = segs[i].x2;
-        eventos[2*i+1]->y = segs[i].y2;
-        eventos[2*i+1]->tipo = EV_FIM;
-        eventos[2*i+1]->seg = &segs[i];
+    bool ordenou = radixSortPares(pares, qtd_ev);
+    if (ordenou) {
+        for (int i = 0; i < qtd_ev; i++) {
+            eventos[i] = copia[pares[i].indice];
+        }
     }
 
-    if (tipo_sort == 'm') {
-        merge_sort((void**)eventos, 0, qtd_ev - 1, threshold, comparar_eventos);
+    free(copia);
+    free(pares);
+    return ordenou;
+}
+
+// Ordena um trecho do vetor de eventos com o algoritmo escolhido (-to)
+static void ordenar_eventos(Evento* eventos, int qtd_ev, char tipo_sort, int threshold) {
+    if (qtd_ev <= 1) return;
+    if (tipo_sort == 'r') {
+        // Sem memória para o radix, o merge sort (estável) dá a mesma ordem
+        if (!ordenar_eventos_radix(eventos, qtd_ev)) {
+            ordenar_eventos_merge(eventos, qtd_ev, threshold);
+        }
+    } else if (tipo_sort == 'm') {
+        ordenar_eventos_merge(eventos, qtd_ev, threshold);
     } else {
-        qsort(eventos, qtd_ev, sizeof(Evento*), (int (*)(const void*, const void*))comparar_eventos);
+        ordena(eventos, qtd_ev, sizeof(Evento), comparar_eventos, TIPO_QSORT, threshold);
     }
+}
 
-    Lista poligono = criaLista(); 
-    
+// Lança o raio de cada evento (já ordenado) e insere o ponto mais próximo no polígono
+static void varrer_eventos(Evento* eventos, int qtd_ev, SegmentoVar* segs, int qtd_segs, double bx, double by, PoligonoVis poligono) {
     for (int i = 0; i < qtd_ev; i++) {
-        double ang = eventos[i]->angulo;
+        double ang = eventos[i].angulo;
         double menorT = HUGE_VAL;
         
         for (int k = 0; k < qtd_segs; k++) {
@@ -185,37 +206,422 @@ Lista calcular_visibilidade(double bx, double by, Lista formas, char tipo_sort,
         }
         
         if (menorT < HUGE_VAL) {
-            // ALOCA A STRUCT INTERNA
-            StPontoVis* p = malloc(sizeof(StPontoVis));
-            p->x = bx + menorT * cos(ang);
-            p->y = by + menorT * sin(ang);
-            
-            // Insere na lista (cast implicito para void*)
-            insereListaFim(poligono, p);
+            adicionaVerticePoligonoVis(poligono, bx + menorT * cos(ang), by + menorT * sin(ang), ang);
         }
-        free(eventos[i]);
     }
+}
+
+// Cria os eventos (início e fim) de cada segmento visto de (bx, by)
+static Evento* criar_eventos(double bx, double by, SegmentoVar* segs, int qtd_segs) {
+    Evento* eventos = malloc(2 * qtd_segs * sizeof(Evento));
+    
+    for (int i = 0; i < qtd_segs; i++) {
+        eventos[2*i].angulo = calcular_angulo(by, bx, segs[i].y1, segs[i].x1);
+        eventos[2*i].tipo = EV_INICIO;
+        eventos[2*i].seg = i;
+
+        eventos[2*i+1].angulo = calcular_angulo(by, bx, segs[i].y2, segs[i].x2);
+        eventos[2*i+1].tipo = EV_FIM;
+        eventos[2*i+1].seg = i;
+    }
+    return eventos;
+}
+
+PoligonoVis calcular_visibilidade(double bx, double by, Lista formas, char tipo_sort, int threshold) {
+    SegmentoVar* segs = NULL;
+    int qtd_segs = extrair_segmentos(bx, by, formas, &segs);
+
+    if (qtd_segs <= 0) {
+        free(segs);
+        return NULL; // Ou retorna lista vazia (-1: falta de memória, já avisada)
+    }
+
+    int qtd_ev = qtd_segs * 2;
+    Evento* eventos = criar_eventos(bx, by, segs, qtd_segs);
+
+    ordenar_eventos(eventos, qtd_ev, tipo_sort, threshold);
+
+    PoligonoVis poligono = criaPoligonoVis(qtd_ev);
+    varrer_eventos(eventos, qtd_ev, segs, qtd_segs, bx, by, poligono);
     
     free(eventos);
     free(segs);
     return poligono;
 }
 
-void desenhar_poligono_visibilidade(FILE* svg, Lista poligono, char* cor) {
+// --- VERSÃO PARALELA (FATIAS ANGULARES) ---
+
+// Fatias por thread: mais fatias que threads equilibra cenas com eventos concentrados
+#define FATIAS_POR_THREAD 4
+
+typedef struct {
+    Evento* eventos;        // eventos da fatia (subvetor do vetor global)
+    int qtd_ev;
+    SegmentoVar* segs;
+    int qtd_segs;
+    double bx, by;
+    char tipo_sort;
+    int threshold;
+    bool ordenar;           // false quando o vetor global já foi ordenado
+    PoligonoVis parcial;    // pontos da fatia, em ordem angular
+} FatiaAngular;
+
+static void tarefa_varrer_fatia(void* arg) {
+    FatiaAngular* f = (FatiaAngular*) arg;
+    if (f->ordenar) {
+        ordenar_eventos(f->eventos, f->qtd_ev, f->tipo_sort, f->threshold);
+    }
+    varrer_eventos(f->eventos, f->qtd_ev, f->segs, f->qtd_segs, f->bx, f->by, f->parcial);
+}
+
+static int fatia_do_angulo(double ang, int qtd_fatias) {
+    int k = (int) ((ang + M_PI) / (2.0 * M_PI) * qtd_fatias);
+    if (k < 0) k = 0;
+    if (k >= qtd_fatias) k = qtd_fatias - 1;
+    return k;
+}
+
+PoligonoVis calcular_visibilidade_paralela(double bx, double by, Lista formas, char tipo_sort, int threshold, PoolThreads pool) {
+    int numThreads = getNumThreadsPool(pool);
+    if (numThreads <= 1) {
+        return calcular_visibilidade(bx, by, formas, tipo_sort, threshold);
+    }
+
+    SegmentoVar* segs = NULL;
+    int qtd_segs = extrair_segmentos(bx, by, formas, &segs);
+
+    if (qtd_segs <= 0) {
+        free(segs);
+        return NULL;
+    }
+
+    int qtd_ev = qtd_segs * 2;
+    int qtd_fatias = numThreads * FATIAS_POR_THREAD;
+    Evento* base = criar_eventos(bx, by, segs, qtd_segs);
+
+    int* inicioFatia = calloc(qtd_fatias + 1, sizeof(int));
+    Evento* eventos;
+    bool ordenarFatias = (tipo_sort != 'm');
+
+    if (tipo_sort == 'm') {
+        // Merge sort paralelo (em tarefas do pool) no vetor inteiro; as fatias
+        // viram blocos de mesmo número de eventos, o que equilibra a varredura
+        // entre threads
+        eventos = base;
+        base = NULL;
+        mergeSortHibridoParalelo(eventos, qtd_ev, sizeof(Evento), comparar_eventos, threshold < 1 ? 1 : threshold, pool);
+        for (int k = 0; k <= qtd_fatias; k++) {
+            inicioFatia[k] = (int) ((long long) qtd_ev * k / qtd_fatias);
+        }
+    } else {
+        // Distribui os eventos em fatias de [-pi, pi] (counting sort pela fatia).
+        // Eventos de mesmo ângulo caem sempre na mesma fatia, então ordenar cada
+        // fatia e concatená-las equivale a ordenar o vetor inteiro.
+        for (int i = 0; i < qtd_ev; i++) {
+            inicioFatia[fatia_do_angulo(base[i].angulo, qtd_fatias) + 1]++;
+        }
+        for (int k = 0; k < qtd_fatias; k++) {
+            inicioFatia[k + 1] += inicioFatia[k];
+        }
+
+        eventos = malloc(qtd_ev * sizeof(Evento));
+        int* preenchidos = calloc(qtd_fatias, sizeof(int));
+        for (int i = 0; i < qtd_ev; i++) {
+            int k = fatia_do_angulo(base[i].angulo, qtd_fatias);
+            eventos[inicioFatia[k] + preenchidos[k]++] = base[i];
+        }
+        free(preenchidos);
+    }
+
+    // Cada fatia é (ordenada e) varrida de forma independente
+    FatiaAngular* fatias = malloc(qtd_fatias * sizeof(FatiaAngular));
+    for (int k = 0; k < qtd_fatias; k++) {
+        fatias[k].eventos = eventos + inicioFatia[k];
+        fatias[k].qtd_ev = inicioFatia[k + 1] - inicioFatia[k];
+        fatias[k].segs = segs;
+        fatias[k].qtd_segs = qtd_segs;
+        fatias[k].bx = bx;
+        fatias[k].by = by;
+        fatias[k].tipo_sort = tipo_sort;
+        fatias[k].threshold = threshold;
+        fatias[k].ordenar = ordenarFatias;
+        fatias[k].parcial = criaPoligonoVis(fatias[k].qtd_ev);
+        if (fatias[k].qtd_ev > 0 && !submetePoolThreads(pool, tarefa_varrer_fatia, &fatias[k])) {
+            tarefa_varrer_fatia(&fatias[k]);
+        }
+    }
+    aguardaPoolThreads(pool);
+
+    // Costura: concatena os polígonos parciais na ordem das fatias
+    PoligonoVis poligono = criaPoligonoVis(qtd_ev);
+    for (int k = 0; k < qtd_fatias; k++) {
+        PoligonoVis parcial = fatias[k].parcial;
+        int n = getQtdVerticesPoligonoVis(parcial);
+        const double *xs = getXsPoligonoVis(parcial);
+        const double *ys = getYsPoligonoVis(parcial);
+        const double *angs = getAngsPoligonoVis(parcial);
+        for (int i = 0; i < n; i++) {
+            adicionaVerticePoligonoVis(poligono, xs[i], ys[i], angs[i]);
+        }
+        destroiPoligonoVis(parcial);
+    }
+
+    free(fatias);
+    free(inicioFatia);
+    free(eventos);
+    free(base);
+    free(segs);
+    return poligono;
+}
+
+// --- REPARO INCREMENTAL ---
+
+// Folga dos intervalos: raios muito próximos do extremo de um segmento
+// ainda podem acertá-lo por arredondamento
+#define FOLGA_ANGULAR 1e-9
+
+// Acima desta fração do círculo, recalcular tudo sai mais barato
+#define FRACAO_MAX_REPARO 0.5
+
+typedef struct {
+    double ini, fim;
+} IntervaloAng;
+
+VEC_DEFINE(VetorIntervalos, IntervaloAng)
+
+static int comparar_intervalos(const void* a, const void* b) {
+    const IntervaloAng* i1 = (const IntervaloAng*)a;
+    const IntervaloAng* i2 = (const IntervaloAng*)b;
+    if (i1->ini < i2->ini) return -1;
+    if (i1->ini > i2->ini) return 1;
+    return 0;
+}
+
+// Arco [ini, fim] (fim - ini < 2pi) com a folga, quebrado no corte em +-pi;
+// false se faltar memória
+static bool add_arco(VetorIntervalos* v, double ini, double fim) {
+    ini -= FOLGA_ANGULAR;
+    fim += FOLGA_ANGULAR;
+    while (ini >= M_PI) { ini -= 2.0 * M_PI; fim -= 2.0 * M_PI; }
+    while (ini < -M_PI) { ini += 2.0 * M_PI; fim += 2.0 * M_PI; }
+
+    if (fim <= M_PI) {
+        return VetorIntervalos_insere(v, (IntervaloAng) { ini, fim });
+    }
+    return VetorIntervalos_insere(v, (IntervaloAng) { ini, M_PI + FOLGA_ANGULAR }) &&
+           VetorIntervalos_insere(v, (IntervaloAng) { -M_PI - FOLGA_ANGULAR, fim - 2.0 * M_PI });
+}
+
+/*
+ * Intervalos angulares (vistos de bx, by) afetados pelos segmentos alterados,
+ * ordenados e sem sobreposição. Cada segmento afeta o arco que cobre (seus
+ * eventos) e o arco oposto: interseccao_raio_seg mede t com o sinal invertido,
+ * então o ponto de um raio vem dos segmentos do lado oposto ao observador. Retorna -1 se algum segmento passa pelo
+ * observador (cobre meio círculo ou mais), caso em que o reparo não compensa,
+ * ou se faltar memória (um arco a menos manteria pontos velhos): nos dois
+ * casos o polígono é recalculado.
+ */
+static int intervalos_afetados(double bx, double by, DiffSegmentos* diffs, int qtd_diffs, IntervaloAng** saida) {
+    VetorIntervalos arcos;
+    VetorIntervalos_inicia(&arcos);
+
+    for (int d = 0; d < qtd_diffs; d++) {
+        int n = getQtdSegmentosDiff(diffs[d]);
+        for (int i = 0; i < n; i++) {
+            double x1, y1, x2, y2;
+            getSegmentoDiff(diffs[d], i, &x1, &y1, &x2, &y2);
+
+            if ((fabs(x1 - bx) < 1e-9 && fabs(y1 - by) < 1e-9) ||
+                (fabs(x2 - bx) < 1e-9 && fabs(y2 - by) < 1e-9)) {
+                VetorIntervalos_libera(&arcos);
+                return -1;
+            }
+
+            double a1 = calcular_angulo(by, bx, y1, x1);
+            double a2 = calcular_angulo(by, bx, y2, x2);
+            double lo = (a1 < a2) ? a1 : a2;
+            double hi = (a1 < a2) ? a2 : a1;
+
+            bool ok;
+            if (hi - lo <= M_PI - FOLGA_ANGULAR) {
+                ok = add_arco(&arcos, lo, hi) &&
+                     add_arco(&arcos, lo + M_PI, hi + M_PI);
+            } else if (hi - lo >= M_PI + FOLGA_ANGULAR) {
+                // O segmento cruza o corte em +-pi
+                ok = add_arco(&arcos, hi, lo + 2.0 * M_PI) &&
+                     add_arco(&arcos, hi + M_PI, lo + 3.0 * M_PI);
+            } else {
+                ok = false;
+            }
+            if (!ok) {
+                VetorIntervalos_libera(&arcos);
+                return -1;
+            }
+        }
+    }
+
+    // Junta intervalos sobrepostos
+    IntervaloAng* v = arcos.itens;
+    int qtd = arcos.tamanho;
+    if (qtd > 1) qsort(v, qtd, sizeof(IntervaloAng), comparar_intervalos);
+    int k = 0;
+    for (int i = 0; i < qtd; i++) {
+        if (k > 0 && v[i].ini <= v[k-1].fim) {
+            if (v[i].fim > v[k-1].fim) v[k-1].fim = v[i].fim;
+        } else {
+            v[k++] = v[i];
+        }
+    }
+
+    *saida = v;
+    return k;
+}
+
+// Busca binária: o ângulo cai em algum dos intervalos (ordenados, disjuntos)?
+static bool angulo_afetado(double ang, IntervaloAng* v, int qtd) {
+    int lo = 0, hi = qtd - 1, achado = -1;
+    while (lo <= hi) {
+        int meio = (lo + hi) / 2;
+        if (v[meio].ini <= ang) {
+            achado = meio;
+            lo = meio + 1;
+        } else {
+            hi = meio - 1;
+        }
+    }
+    return achado >= 0 && ang <= v[achado].fim;
+}
+
+PoligonoVis reparar_visibilidade(double bx, double by, Lista formas, PoligonoVis poligono, DiffSegmentos* diffs, int qtd_diffs, char tipo_sort, int threshold) {
+    if (!poligono) {
+        return calcular_visibilidade(bx, by, formas, tipo_sort, threshold);
+    }
+
+    IntervaloAng* intervalos = NULL;
+    int qtd_int = intervalos_afetados(bx, by, diffs, qtd_diffs, &intervalos);
+    if (qtd_int == 0) {
+        free(intervalos);
+        return poligono;
+    }
+
+    double cobertura = 0.0;
+    for (int i = 0; i < qtd_int; i++) cobertura += intervalos[i].fim - intervalos[i].ini;
+
+    if (qtd_int < 0 || cobertura > FRACAO_MAX_REPARO * 2.0 * M_PI) {
+        free(intervalos);
+        destroiPoligonoVis(poligono);
+        return calcular_visibilidade(bx, by, formas, tipo_sort, threshold);
+    }
+
+    SegmentoVar* segs = NULL;
+    int qtd_segs = extrair_segmentos(bx, by, formas, &segs);
+    if (qtd_segs <= 0) {
+        free(segs);
+        free(intervalos);
+        destroiPoligonoVis(poligono);
+        return NULL;
+    }
+
+    // Eventos dos segmentos atuais que caem nos intervalos afetados
+    int qtd_ev = 0;
+    Evento* eventos = malloc(2 * qtd_segs * sizeof(Evento));
+    for (int i = 0; i < qtd_segs; i++) {
+        double a1 = calcular_angulo(by, bx, segs[i].y1, segs[i].x1);
+        double a2 = calcular_angulo(by, bx, segs[i].y2, segs[i].x2);
+        if (angulo_afetado(a1, intervalos, qtd_int)) {
+            eventos[qtd_ev].angulo = a1;
+            eventos[qtd_ev].tipo = EV_INICIO;
+            eventos[qtd_ev].seg = i;
+            qtd_ev++;
+        }
+        if (angulo_afetado(a2, intervalos, qtd_int)) {
+            eventos[qtd_ev].angulo = a2;
+            eventos[qtd_ev].tipo = EV_FIM;
+            eventos[qtd_ev].seg = i;
+            qtd_ev++;
+        }
+    }
+
+    ordenar_eventos(eventos, qtd_ev, tipo_sort, threshold);
+    PoligonoVis novos = criaPoligonoVis(qtd_ev);
+    varrer_eventos(eventos, qtd_ev, segs, qtd_segs, bx, by, novos);
+
+    // Emenda: pontos antigos fora dos intervalos + pontos novos, em ordem angular
+    int qtdAntigos = getQtdVerticesPoligonoVis(poligono);
+    const double *xa = getXsPoligonoVis(poligono), *ya = getYsPoligonoVis(poligono), *aa = getAngsPoligonoVis(poligono);
+    int qtdNovos = getQtdVerticesPoligonoVis(novos);
+    const double *xn = getXsPoligonoVis(novos), *yn = getYsPoligonoVis(novos), *an = getAngsPoligonoVis(novos);
+
+    PoligonoVis reparado = criaPoligonoVis(qtdAntigos + qtdNovos);
+    int j = 0;
+    for (int i = 0; i < qtdAntigos; i++) {
+        if (angulo_afetado(aa[i], intervalos, qtd_int)) continue;
+        while (j < qtdNovos && an[j] < aa[i]) {
+            adicionaVerticePoligonoVis(reparado, xn[j], yn[j], an[j]);
+            j++;
+        }
+        adicionaVerticePoligonoVis(reparado, xa[i], ya[i], aa[i]);
+    }
+    for (; j < qtdNovos; j++) {
+        adicionaVerticePoligonoVis(reparado, xn[j], yn[j], an[j]);
+    }
+
+    destroiPoligonoVis(novos);
+    destroiPoligonoVis(poligono);
+    free(eventos);
+    free(segs);
+    free(intervalos);
+    return reparado;
+}
+
+// --- EXPANSÃO TRIANGULAR ---
+
+Triangulacao preparar_triangulacao(Lista formas) {
+    SegmentoVar* segs = NULL;
+    int qtd_segs = extrair_segmentos(0.0, 0.0, formas, &segs);
+    if (qtd_segs < 0) {
+        return NULL; // quem chama usa a varredura angular
+    }
+
+    // SegmentoVar são 4 doubles contíguos (x1, y1, x2, y2)
+    Triangulacao t = criaTriangulacao((const double*)segs, qtd_segs);
+    free(segs);
+    return t;
+}
+
+PoligonoVis calcular_visibilidade_triangulacao(Triangulacao t, double bx, double by, Lista formas, char tipo_sort, int threshold) {
+    if (getQtdArestasRestritas(t) == 0) {
+        return NULL; // Sem obstáculos, como em calcular_visibilidade
+    }
+
+    double *xs, *ys;
+    int qtd = visibilidadeTriangulacao(t, bx, by, &xs, &ys);
+    if (qtd < 0) {
+        // Observador fora da caixa da triangulação
+        return calcular_visibilidade(bx, by, formas, tipo_sort, threshold);
+    }
+
+    PoligonoVis poligono = criaPoligonoVis(qtd);
+    for (int i = 0; i < qtd; i++) {
+        adicionaVerticePoligonoVis(poligono, xs[i], ys[i], atan2(ys[i] - by, xs[i] - bx));
+    }
+
+    free(xs);
+    free(ys);
+    return poligono;
+}
+
+void desenhar_poligono_visibilidade(FILE* svg, PoligonoVis poligono, char* cor) {
     if (!poligono || !svg) return;
     
     fprintf(svg, "\n<polygon points=\"");
     
-    int qtd = tamanhoLista(poligono);
+    int qtd = getQtdVerticesPoligonoVis(poligono);
+    const double *xs = getXsPoligonoVis(poligono);
+    const double *ys = getYsPoligonoVis(poligono);
     for(int i=0; i<qtd; i++) {
-        PontoVis p = getListaPosicao(poligono, i);
-        // USA OS GETTERS
-        fprintf(svg, "%.2f,%.2f ", getPontoVisX(p), getPontoVisY(p));
+        fprintf(svg, "%.2f,%.2f ", xs[i], ys[i]);
     }
     
     fprintf(svg, "\" fill=\"%s\" opacity=\"0.5\" stroke=\"none\" />\n", cor);
 }
-
-void destruir_lista_pontos(Lista poligono) {
-    destroiListaCompleta(poligono, free);
-}
\ No newline at end of file
@@ -3,29 +3,59 @@
 
 #include <stdio.h>
 #include "lista.h"
-
-// Define PontoVis como um tipo opaco (ponteiro genérico)
-// A estrutura real fica escondida no .c
-typedef void* PontoVis;
+#include "diffsegmentos.h"
+#include "triangulacao.h"
+#include "poligonovis.h"
+#include "poolthreads.h"
 
 /*
  * Calcula o poligono de visibilidade.
- * Retorna uma Lista de PontoVis (opacos).
+ * Retorna um PoligonoVis (liberar com destroiPoligonoVis), ou NULL se o
+ * cenário não tem obstáculos.
  */
-Lista calcular_visibilidade(double bx, double by, Lista formas, char tipo_sort, int threshold);
+PoligonoVis calcular_visibilidade(double bx, double by, Lista formas, char tipo_sort, int threshold);
 
 /*
- * Gera o SVG do poligono de visibilidade
+ * Mesmo resultado de calcular_visibilidade, dividindo o intervalo [-pi, pi]
+ * em fatias angulares que são ordenadas e varridas pelas threads do pool
+ * (criado uma vez pelo chamador e reaproveitado entre chamadas).
+ * Os polígonos parciais são concatenados na ordem das fatias.
+ * Com pool NULL ou de uma thread equivale a calcular_visibilidade.
+ * Não deve ser chamada de dentro de uma tarefa do próprio pool (a espera
+ * pelas fatias incluiria a tarefa que espera).
+ */
+PoligonoVis calcular_visibilidade_paralela(double bx, double by, Lista formas, char tipo_sort, int threshold, PoolThreads pool);
+
+/*
+ * Repara um polígono já calculado para (bx, by) depois que os segmentos
+ * registrados em diffs[0..qtd_diffs-1] entraram ou saíram do cenário.
+ * Só os intervalos angulares cobertos por esses segmentos são varridos
+ * de novo, com os segmentos atuais de 'formas'; os demais pontos do
+ * polígono são mantidos. O resultado é o mesmo de calcular_visibilidade.
+ * Se as alterações cobrem boa parte do círculo, recalcula tudo.
+ * 'poligono' é consumido; retorna o polígono reparado.
  */
-void desenhar_poligono_visibilidade(FILE* svg, Lista poligono, char* cor_preenchimento);
+PoligonoVis reparar_visibilidade(double bx, double by, Lista formas, PoligonoVis poligono, DiffSegmentos* diffs, int qtd_diffs, char tipo_sort, int threshold);
 
 /*
- * Libera memória da lista de pontos
+ * Constrói a triangulação restrita dos obstáculos atuais de 'formas'
+ * (os mesmos segmentos usados pela varredura). Liberar com
+ * destroiTriangulacao; deve ser refeita quando os obstáculos mudam.
  */
-void destruir_lista_pontos(Lista poligono);
+Triangulacao preparar_triangulacao(Lista formas);
 
-//  FUNÇÕES GETTERS 
-double getPontoVisX(PontoVis p);
-double getPontoVisY(PontoVis p);
+/*
+ * Calcula o polígono de visibilidade de (bx, by) por expansão triangular
+ * sobre 't', construída a partir de 'formas'. O polígono é o conjunto
+ * geometricamente visível, limitado pela caixa da triangulação, e não
+ * reproduz ponto a ponto o da varredura. Se (bx, by) estiver fora da
+ * caixa, usa calcular_visibilidade com tipo_sort e threshold.
+ */
+PoligonoVis calcular_visibilidade_triangulacao(Triangulacao t, double bx, double by, Lista formas, char tipo_sort, int threshold);
+
+/*
+ * Gera o SVG do poligono de visibilidade
+ */
+void desenhar_poligono_visibilidade(FILE* svg, PoligonoVis poligono, char* cor_preenchimento);
 
-#endif
\ No newline at end of file
+#endif
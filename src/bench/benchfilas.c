@@ -0,0 +1,186 @@
+#define _POSIX_C_SOURCE 200809L
+
+/*
+ * Vazão das filas entre threads (make bench-filas). Não faz parte do ted.
+ *
+ * Cada caso passa ITENS itens (os números 1..ITENS) de P produtores para
+ * C consumidores e confere a soma do que foi recebido:
+ * - fila.h protegida por mutex (referência: como o pool usa hoje), limitada
+ *   à mesma capacidade das outras (recusa o item com a fila cheia);
+ * - FilaSPSC, FilaMPMC e FilaBloqueante (filaconcorrente.h).
+ * Nas filas não bloqueantes, quem encontra a fila cheia/vazia cede a CPU
+ * (sched_yield) e tenta de novo. A FilaBloqueante faz o mesmo algumas vezes
+ * e só então dorme numa condvar.
+ *
+ * Uso: ./benchfilas [itens] [capacidade]
+ */
+
+#include "fila.h"
+#include "filaconcorrente.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define MAX_THREADS 8
+
+typedef enum { FILA_MUTEX, FILA_SPSC, FILA_MPMC, FILA_BLOQUEANTE } TipoFilaBench;
+
+typedef struct {
+    TipoFilaBench tipo;
+    void *fila;
+    pthread_mutex_t trava;      // só para FILA_MUTEX
+    int capacidade;             // só para FILA_MUTEX (as outras já são limitadas)
+    long itens;
+    int produtores;
+    int consumidores;
+} CasoBench;
+
+typedef struct {
+    CasoBench *caso;
+    long primeiro, ultimo;      // produtor: faixa de itens
+    long quantos;               // consumidor: itens a receber
+    long long soma;
+} ArgThread;
+
+static bool enfileiraCaso(CasoBench *c, void *item) {
+    switch (c->tipo) {
+        case FILA_MUTEX: {
+            pthread_mutex_lock(&c->trava);
+            bool ok = getTamanhoFila(c->fila) < c->capacidade;
+            if (ok) enfileira(c->fila, item);
+            pthread_mutex_unlock(&c->trava);
+            return ok;
+        }
+        case FILA_SPSC:       return enfileiraSPSC(c->fila, item);
+        case FILA_MPMC:       return enfileiraMPMC(c->fila, item);
+        case FILA_BLOQUEANTE: return enfileiraBloqueante(c->fila, item);
+    }
+    return false;
+}
+
+static bool desenfileiraCaso(CasoBench *c, void **item) {
+    switch (c->tipo) {
+        case FILA_MUTEX: {
+            pthread_mutex_lock(&c->trava);
+            bool ok = !estaVaziaFila(c->fila);
+            if (ok) *item = desenfileira(c->fila);
+            pthread_mutex_unlock(&c->trava);
+            return ok;
+        }
+        case FILA_SPSC:       return desenfileiraSPSC(c->fila, item);
+        case FILA_MPMC:       return desenfileiraMPMC(c->fila, item);
+        case FILA_BLOQUEANTE: return desenfileiraBloqueante(c->fila, item);
+    }
+    return false;
+}
+
+static void* produtor(void *arg) {
+    ArgThread *a = (ArgThread*) arg;
+    for (long i = a->primeiro; i <= a->ultimo; i++) {
+        while (!enfileiraCaso(a->caso, (void*) (intptr_t) i)) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void* consumidor(void *arg) {
+    ArgThread *a = (ArgThread*) arg;
+    for (long k = 0; k < a->quantos; k++) {
+        void *item;
+        while (!desenfileiraCaso(a->caso, &item)) {
+            sched_yield();
+        }
+        a->soma += (intptr_t) item;
+    }
+    return NULL;
+}
+
+static double agora() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+// Retorna a vazão medida, em itens por segundo
+static void executaCaso(const char *nome, CasoBench *c) {
+    pthread_t threads[2 * MAX_THREADS];
+    ArgThread args[2 * MAX_THREADS];
+    int n = 0;
+    double inicio = agora();
+
+    for (int i = 0; i < c->consumidores; i++, n++) {
+        args[n].caso = c;
+        args[n].quantos = c->itens / c->consumidores + (i < c->itens % c->consumidores ? 1 : 0);
+        args[n].soma = 0;
+        pthread_create(&threads[n], NULL, consumidor, &args[n]);
+    }
+    long porProdutor = c->itens / c->produtores;
+    for (int i = 0; i < c->produtores; i++, n++) {
+        args[n].caso = c;
+        args[n].primeiro = i * porProdutor + 1;
+        args[n].ultimo = (i == c->produtores - 1) ? c->itens : (i + 1) * porProdutor;
+        pthread_create(&threads[n], NULL, produtor, &args[n]);
+    }
+
+    long long soma = 0;
+    for (int i = 0; i < n; i++) {
+        pthread_join(threads[i], NULL);
+        if (i < c->consumidores) soma += args[i].soma;
+    }
+    double segundos = agora() - inicio;
+
+    long long esperado = (long long) c->itens * (c->itens + 1) / 2;
+    printf("%-26s %dP/%dC  %8.2f Mitens/s  %s\n", nome, c->produtores, c->consumidores,
+           c->itens / segundos / 1e6, (soma == esperado) ? "ok" : "SOMA ERRADA");
+}
+
+int main(int argc, char *argv[]) {
+    long itens = (argc > 1) ? atol(argv[1]) : 2000000;
+    int capacidade = (argc > 2) ? atoi(argv[2]) : 1024;
+    if (itens <= 0 || capacidade <= 0) {
+        fprintf(stderr, "Uso: %s [itens] [capacidade]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    printf("%ld itens, capacidade %d\n", itens, capacidade);
+
+    CasoBench c;
+    c.itens = itens;
+    c.capacidade = capacidade;
+    pthread_mutex_init(&c.trava, NULL);
+
+    int configuracoes[][2] = { {1, 1}, {2, 2}, {4, 4} };
+    for (int k = 0; k < 3; k++) {
+        c.produtores = configuracoes[k][0];
+        c.consumidores = configuracoes[k][1];
+
+        c.tipo = FILA_MUTEX;
+        c.fila = createQueueCapacidade(capacidade);
+        executaCaso("fila.h + mutex", &c);
+        destroiFila(c.fila);
+
+        if (c.produtores == 1 && c.consumidores == 1) {
+            c.tipo = FILA_SPSC;
+            c.fila = criaFilaSPSC(capacidade);
+            executaCaso("FilaSPSC", &c);
+            destroiFilaSPSC(c.fila);
+        }
+
+        c.tipo = FILA_MPMC;
+        c.fila = criaFilaMPMC(capacidade);
+        executaCaso("FilaMPMC", &c);
+        destroiFilaMPMC(c.fila);
+
+        c.tipo = FILA_BLOQUEANTE;
+        c.fila = criaFilaBloqueante(capacidade);
+        executaCaso("FilaBloqueante", &c);
+        destroiFilaBloqueante(c.fila);
+    }
+
+    pthread_mutex_destroy(&c.trava);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,127 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "loteqry.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#define MAX_LINHA_LISTA 1024
+
+/*________________________________ FUNÇÕES AUXILIARES INTERNAS ________________________________*/
+
+// Espera um filho terminar; retorna 1 se ele falhou, 0 se não, -1 se não há filhos
+static int aguardaFilho(Lista consultas, pid_t *pids, int qtd) {
+    int status;
+    pid_t pid = wait(&status);
+    if (pid < 0) return -1;
+
+    for (int i = 0; i < qtd; i++) {
+        if (pids[i] != pid) continue;
+
+        const char *consulta = (const char*) getListaPosicao(consultas, i);
+        if (WIFSIGNALED(status)) {
+            fprintf(stderr, "Erro: consulta %s terminou com o sinal %d.\n", consulta, WTERMSIG(status));
+            return 1;
+        }
+        if (WIFEXITED(status) && WEXITSTATUS(status) != 0) {
+            fprintf(stderr, "Erro: consulta %s terminou com codigo %d.\n", consulta, WEXITSTATUS(status));
+            return 1;
+        }
+        return 0;
+    }
+    return 0;
+}
+
+/*________________________________ LOTE ________________________________*/
+
+int executaLoteQry(Lista consultas, int maxParalelos, ExecutaConsulta executa, void *dados) {
+    int qtd = tamanhoLista(consultas);
+    if (qtd == 0 || !executa) return 0;
+
+    // Uma consulta só não precisa de isolamento
+    if (qtd == 1) {
+        return executa((const char*) getListaInicio(consultas), dados) != EXIT_SUCCESS;
+    }
+
+    if (maxParalelos < 1) maxParalelos = 1;
+
+    pid_t *pids = calloc(qtd, sizeof(pid_t));
+    if (!pids) {
+        fprintf(stderr, "Erro: falha ao alocar o lote de consultas.\n");
+        return qtd;
+    }
+
+    int falhas = 0;
+    int ativos = 0;
+    for (int i = 0; i < qtd; i++) {
+        if (ativos >= maxParalelos) {
+            int r = aguardaFilho(consultas, pids, qtd);
+            if (r > 0) falhas++;
+            if (r >= 0) ativos--;
+        }
+
+        // Sem isso o filho herdaria (e repetiria) a saída ainda no buffer
+        fflush(NULL);
+
+        pid_t pid = fork();
+        if (pid < 0) {
+            perror("Erro: fork");
+            fprintf(stderr, "Erro: consulta %s nao executada.\n", (const char*) getListaPosicao(consultas, i));
+            falhas++;
+            continue;
+        }
+        if (pid == 0) {
+            int codigo = executa((const char*) getListaPosicao(consultas, i), dados);
+            fflush(NULL);
+            _exit(codigo);
+        }
+
+        pids[i] = pid;
+        ativos++;
+    }
+
+    while (ativos > 0) {
+        int r = aguardaFilho(consultas, pids, qtd);
+        if (r < 0) break;
+        if (r > 0) falhas++;
+        ativos--;
+    }
+
+    free(pids);
+    return falhas;
+}
+
+int leListaQry(const char *caminho, Lista consultas) {
+    FILE *arq = fopen(caminho, "r");
+    if (!arq) {
+        fprintf(stderr, "Erro: nao foi possivel abrir a lista de consultas %s.\n", caminho);
+        return -1;
+    }
+
+    int lidos = 0;
+    char linha[MAX_LINHA_LISTA];
+    while (fgets(linha, sizeof(linha), arq)) {
+        // Remove espaços nas pontas (inclui o '\n')
+        char *inicio = linha;
+        while (isspace((unsigned char) *inicio)) inicio++;
+        char *fim = inicio + strlen(inicio);
+        while (fim > inicio && isspace((unsigned char) fim[-1])) fim--;
+        *fim = '\0';
+
+        if (*inicio == '\0' || *inicio == '#') continue;
+
+        char *copia = malloc(strlen(inicio) + 1);
+        if (!copia) break;
+        strcpy(copia, inicio);
+        insereListaFim(consultas, copia);
+        lidos++;
+    }
+
+    fclose(arq);
+    return lidos;
+}
@@ -0,0 +1,57 @@
+#ifndef LOTEQRY_H
+#define LOTEQRY_H
+
+#include "lista.h"
+
+/*
+*        MÓDULO DE LOTE DE CONSULTAS
+*
+*        Executa vários .qry sobre um único .geo já lido. Cada consulta
+*        roda num processo filho (fork): o filho herda o cenário por
+*        cópia-na-escrita, então as destruições, clones e anteparos de uma
+*        consulta não aparecem nas outras, e o .geo é lido uma vez só.
+*
+*        Até maxParalelos filhos rodam ao mesmo tempo; com 1, as consultas
+*        são executadas uma após a outra (ainda isoladas). Um lote com uma
+*        única consulta roda no próprio processo.
+*
+*        O lote deve ser disparado enquanto o processo tem uma única
+*        thread (antes de criar pools), pois o fork copia só a thread
+*        que o chama.
+*/
+
+/*
+Função que processa uma consulta (caminho do .qry, como informado) no
+processo atual; 'dados' é repassado sem alteração. Retorna o código de
+saída da consulta: EXIT_SUCCESS, ou outro valor se ela falhou (ex.: .qry
+ausente ou ilegível).
+*/
+typedef int (*ExecutaConsulta)(const char *consulta, void *dados);
+
+/*
+Executa cada consulta da lista em isolamento.
+
+* consultas: lista de caminhos (char*) dos .qry
+* maxParalelos: máximo de consultas simultâneas (< 1 vira 1)
+* executa: função que processa uma consulta
+* dados: contexto repassado a 'executa'
+
+Pré-condição: consultas e executa válidos
+Pós-condição: retorna o número de consultas que falharam ('executa'
+              retornou um código diferente de EXIT_SUCCESS, filho terminado
+              por sinal ou que não pôde ser criado)
+*/
+int executaLoteQry(Lista consultas, int maxParalelos, ExecutaConsulta executa, void *dados);
+
+/*
+Lê um arquivo com um caminho de .qry por linha (linhas vazias e as
+iniciadas por '#' são ignoradas) e insere cópias dos caminhos no fim de
+'consultas' (liberar cada uma com free).
+
+Pré-condição: caminho e consultas válidos
+Pós-condição: retorna o número de caminhos lidos, ou -1 se o arquivo não
+              pôde ser aberto
+*/
+int leListaQry(const char *caminho, Lista consultas);
+
+#endif
@@ -0,0 +1,98 @@
+#include "opcoes.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct opcoes {
+    char tipoSort;
+    int threshold;
+    int numThreads;
+    char motorVis;
+    double toleranciaSimp;   // < 0: sem simplificação
+    bool gerarSvg;
+    bool aplicarEfeitos;     // false: simulação (só relatório)
+} OpcoesStruct;
+
+Opcoes criaOpcoes() {
+    OpcoesStruct *o = (OpcoesStruct*) malloc(sizeof(OpcoesStruct));
+    if (o == NULL) {
+        fprintf(stderr, "Erro: falha ao alocar opcoes.\n");
+        return NULL;
+    }
+
+    o->tipoSort = 'q';
+    o->threshold = 10;
+    o->numThreads = 1;
+    o->motorVis = 's';
+    o->toleranciaSimp = -1.0;
+    o->gerarSvg = true;
+    o->aplicarEfeitos = true;
+
+    return (Opcoes) o;
+}
+
+void destroiOpcoes(Opcoes o) {
+    if (o == NULL) {
+        return;
+    }
+    free(o);
+}
+
+char getTipoSortOpcoes(Opcoes o) {
+    return ((OpcoesStruct*) o)->tipoSort;
+}
+
+void setTipoSortOpcoes(Opcoes o, char tipo) {
+    if (tipo == 'q' || tipo == 'm' || tipo == 'r') {
+        ((OpcoesStruct*) o)->tipoSort = tipo;
+    }
+}
+
+int getThresholdOpcoes(Opcoes o) {
+    return ((OpcoesStruct*) o)->threshold;
+}
+
+void setThresholdOpcoes(Opcoes o, int threshold) {
+    ((OpcoesStruct*) o)->threshold = threshold;
+}
+
+int getNumThreadsOpcoes(Opcoes o) {
+    return ((OpcoesStruct*) o)->numThreads;
+}
+
+void setNumThreadsOpcoes(Opcoes o, int numThreads) {
+    ((OpcoesStruct*) o)->numThreads = (numThreads < 1) ? 1 : numThreads;
+}
+
+char getMotorVisOpcoes(Opcoes o) {
+    return ((OpcoesStruct*) o)->motorVis;
+}
+
+void setMotorVisOpcoes(Opcoes o, char motor) {
+    if (motor == 's' || motor == 't') {
+        ((OpcoesStruct*) o)->motorVis = motor;
+    }
+}
+
+double getToleranciaSimpOpcoes(Opcoes o) {
+    return ((OpcoesStruct*) o)->toleranciaSimp;
+}
+
+void setToleranciaSimpOpcoes(Opcoes o, double tolerancia) {
+    ((OpcoesStruct*) o)->toleranciaSimp = tolerancia;
+}
+
+bool getGerarSvgOpcoes(Opcoes o) {
+    return ((OpcoesStruct*) o)->gerarSvg;
+}
+
+void setGerarSvgOpcoes(Opcoes o, bool gerar) {
+    ((OpcoesStruct*) o)->gerarSvg = gerar;
+}
+
+bool getAplicarEfeitosOpcoes(Opcoes o) {
+    return ((OpcoesStruct*) o)->aplicarEfeitos;
+}
+
+void setAplicarEfeitosOpcoes(Opcoes o, bool aplicar) {
+    ((OpcoesStruct*) o)->aplicarEfeitos = aplicar;
+}
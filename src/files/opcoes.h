@@ -0,0 +1,92 @@
+#ifndef OPCOES_H
+#define OPCOES_H
+
+/*
+*        MÓDULO DE OPÇÕES DE EXECUÇÃO
+*
+*        Guarda os parâmetros lidos da linha de comando que afetam o
+*        processamento das consultas (ordenação, threads, motor de
+*        visibilidade). É criado pelo main e repassado ao processaQry,
+*        evitando que cada nova opção mude a assinatura das funções.
+*
+*        Valores padrão: ordenação 'q', threshold 10, 1 thread,
+*        motor de visibilidade 's' (varredura angular), sem simplificação
+*        dos polígonos, com SVGs e com os efeitos das bombas aplicados.
+*/
+
+#include <stdbool.h>
+
+typedef void *Opcoes;
+
+/*                    FUNÇÕES DE CRIAÇÃO E DESTRUIÇÃO                    */
+
+/*
+Cria um conjunto de opções com os valores padrão.
+
+Pré-condição: nenhuma
+Pós-condição: retorna as opções, ou NULL em caso de falha
+*/
+Opcoes criaOpcoes();
+
+/*
+Libera a memória das opções.
+
+* o: ponteiro para as opções
+
+Pré-condição: o deve ser válido ou NULL
+Pós-condição: memória liberada
+*/
+void destroiOpcoes(Opcoes o);
+
+/*                    GETTERS E SETTERS                    */
+
+/*
+Tipo de ordenação dos eventos: 'q', 'm' ou 'r'
+(QuickSort, MergeSort ou RadixSort). Outros valores são ignorados.
+*/
+char getTipoSortOpcoes(Opcoes o);
+void setTipoSortOpcoes(Opcoes o, char tipo);
+
+/*
+Limite para o Insertion Sort.
+*/
+int getThresholdOpcoes(Opcoes o);
+void setThresholdOpcoes(Opcoes o, int threshold);
+
+/*
+Threads para a visibilidade (valores < 1 viram 1).
+*/
+int getNumThreadsOpcoes(Opcoes o);
+void setNumThreadsOpcoes(Opcoes o, int numThreads);
+
+/*
+Motor de visibilidade: 's' (varredura angular) ou 't' (expansão sobre
+a triangulação restrita dos obstáculos). Outros valores são ignorados.
+*/
+char getMotorVisOpcoes(Opcoes o);
+void setMotorVisOpcoes(Opcoes o, char motor);
+
+/*
+Tolerância da simplificação dos polígonos de visibilidade (ver
+simplificaPoligonoVis). Negativa desliga a simplificação; 0 remove só o
+que não altera o polígono.
+*/
+double getToleranciaSimpOpcoes(Opcoes o);
+void setToleranciaSimpOpcoes(Opcoes o, double tolerancia);
+
+/*
+Se false, nenhum SVG é gerado (nem o inicial do .geo, nem os das bombas);
+só o relatório .txt é escrito.
+*/
+bool getGerarSvgOpcoes(Opcoes o);
+void setGerarSvgOpcoes(Opcoes o, bool gerar);
+
+/*
+Se false (simulação), as bombas não alteram o cenário: o relatório lista
+as formas que cada comando atingiria, todas avaliadas sobre o cenário
+inicial.
+*/
+bool getAplicarEfeitosOpcoes(Opcoes o);
+void setAplicarEfeitosOpcoes(Opcoes o, bool aplicar);
+
+#endif
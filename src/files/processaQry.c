@@ -17,6 +17,11 @@
 #include "circulo.h"
 #include "texto.h"
 #include "anteparo.h" 
+#include "poolthreads.h"
+#include "cachevis.h"
+#include "diffsegmentos.h"
+#include "cenario.h"
+#include "mapatipado.h"
 
 #ifndef PI
 #define PI 3.14159265358979323846
@@ -75,35 +80,7 @@ void relatarForma(FILE* txt, Forma f, char* titulo) {
 
 // --- GEOMETRIA ---
 
-bool pontoInternoVis(double x, double y, Lista poligonoVis) {
-    bool inside = false;
-    int n = tamanhoLista(poligonoVis);
-    if (n < 3) return false;
-
-    double* VX = malloc(n * sizeof(double));
-    double* VY = malloc(n * sizeof(double));
-
-    for(int i=0; i<n; i++) {
-        PontoVis p = getListaPosicao(poligonoVis, i);
-        if (p) {
-            VX[i] = getPontoVisX(p); 
-            VY[i] = getPontoVisY(p); 
-        }
-    }
-
-    for (int i = 0, j = n - 1; i < n; j = i++) {
-        if (((VY[i] > y) != (VY[j] > y)) &&
-            (x < (VX[j] - VX[i]) * (y - VY[i]) / (VY[j] - VY[i]) + VX[i])) {
-            inside = !inside;
-        }
-    }
-
-    free(VX);
-    free(VY);
-    return inside;
-}
-
-bool formaNoPoligonoVis(Forma f, Lista regiao) {
+bool formaNoPoligonoVis(Forma f, PoligonoVis regiao) {
     if (!f || !regiao) return false;
 
     TipoForma tipo = getFormaTipo(f);
@@ -113,7 +90,7 @@ bool formaNoPoligonoVis(Forma f, Lista regiao) {
         case TIPO_CIRCULO: {
             double cx = getXCirculo((Circulo)dados); 
             double cy = getYCirculo((Circulo)dados); 
-            return pontoInternoVis(cx, cy, regiao);
+            return pontoInternoPoligonoVis(regiao, cx, cy);
         }
         case TIPO_RETANGULO: {
             double rx = getXRetangulo((Retangulo)dados);       
@@ -121,10 +98,10 @@ bool formaNoPoligonoVis(Forma f, Lista regiao) {
             double w = getLarguraRetangulo((Retangulo)dados);  
             double h = getAlturaRetangulo((Retangulo)dados);   
             
-            if (pontoInternoVis(rx, ry, regiao)) return true;
-            if (pontoInternoVis(rx+w, ry, regiao)) return true;
-            if (pontoInternoVis(rx+w, ry+h, regiao)) return true;
-            if (pontoInternoVis(rx, ry+h, regiao)) return true;
+            if (pontoInternoPoligonoVis(regiao, rx, ry)) return true;
+            if (pontoInternoPoligonoVis(regiao, rx+w, ry)) return true;
+            if (pontoInternoPoligonoVis(regiao, rx+w, ry+h)) return true;
+            if (pontoInternoPoligonoVis(regiao, rx, ry+h)) return true;
             return false;
         }
         case TIPO_LINHA: {
@@ -132,12 +109,12 @@ bool formaNoPoligonoVis(Forma f, Lista regiao) {
             double y1 = getY1Linha((Linha)dados); 
             double x2 = getX2Linha((Linha)dados); 
             double y2 = getY2Linha((Linha)dados); 
-            return pontoInternoVis(x1, y1, regiao) || pontoInternoVis(x2, y2, regiao);
+            return pontoInternoPoligonoVis(regiao, x1, y1) || pontoInternoPoligonoVis(regiao, x2, y2);
         }
         case TIPO_TEXTO: {
             double x = getXTexto(dados);  
             double y = getYTexto(dados); 
-            return pontoInternoVis(x, y, regiao);
+            return pontoInternoPoligonoVis(regiao, x, y);
         }
     }
     return false;
@@ -178,8 +155,34 @@ Forma clonaForma(Forma forma, double dx, double dy, int novoId) {
 }
 
 // --- EFEITOS ---
+//
+// 'formas' é a vista do cenário (listaFormasCenario). Cada efeito repete na
+// vista a mudança que faz no cenário, na mesma posição, em vez de refazê-la
+// inteira depois de cada comando.
 
-void aplicarDestruicao(Lista formas, Lista poligonoVis, FILE* txt) {
+// Versão alterável da forma da posição i; se o cenário a trocou por uma
+// cópia (instantâneo compartilhado), a vista passa a apontar para a cópia
+static Forma formaMutavelVista(Cenario cenario, Lista formas, int i) {
+    Forma f = (Forma) getListaPosicao(formas, i);
+    Forma alteravel = formaMutavelCenario(cenario, f);
+    if (alteravel != NULL && alteravel != f) {
+        removeListaPosicao(formas, i);
+        insereListaPosicao(formas, alteravel, i);
+    }
+    return alteravel;
+}
+
+// Insere uma forma nova no fim do cenário e da vista
+static void insereFormaVista(Cenario cenario, Lista formas, Forma f) {
+    if (insereFormaCenario(cenario, f)) {
+        insereListaFim(formas, f);
+    }
+}
+
+// Retorna quantas das formas removidas eram obstáculos (linhas ou retângulos),
+// registrando os segmentos removidos em 'diff' (se não for NULL)
+int aplicarDestruicao(Cenario cenario, Lista formas, PoligonoVis poligonoVis, FILE* txt, DiffSegmentos diff) {
+    int obstaculos = 0;
     int qtd = tamanhoLista(formas);
     for (int i = qtd - 1; i >= 0; i--) {
         Forma f = (Forma) getListaPosicao(formas, i);
@@ -187,22 +190,27 @@ void aplicarDestruicao(Lista formas, Lista poligonoVis, FILE* txt) {
             if (txt) {
                 relatarForma(txt, f, " FORMA DESTRUÍDA: ");
             }
-            removeListaPosicao(formas, i);
+            if (registraFormaDiff(diff, f) > 0) obstaculos++;
+            if (removeFormaCenario(cenario, f)) {
+                removeListaPosicao(formas, i);
+            }
         }
     }
+    return obstaculos;
 }
 
-void aplicarPintura(Lista formas, Lista poligonoVis, char* cor) {
+void aplicarPintura(Cenario cenario, Lista formas, PoligonoVis poligonoVis, char* cor) {
     int qtd = tamanhoLista(formas);
     for (int i = 0; i < qtd; i++) {
         Forma f = (Forma) getListaPosicao(formas, i);
         if (formaNoPoligonoVis(f, poligonoVis)) {
-            setFormaCorPreenchimento(f, cor);
+            // Forma compartilhada com um instantâneo é copiada antes
+            setFormaCorPreenchimento(formaMutavelVista(cenario, formas, i), cor);
         }
     }
 }
 
-void aplicarClonagem(Lista formas, Lista poligonoVis, double dx, double dy, Gerador gerador) {
+void aplicarClonagem(Cenario cenario, Lista formas, PoligonoVis poligonoVis, double dx, double dy, Gerador gerador, DiffSegmentos diff) {
     Lista clones = criaLista();
     int qtd = tamanhoLista(formas);
     
@@ -219,7 +227,8 @@ void aplicarClonagem(Lista formas, Lista poligonoVis, double dx, double dy, Gera
         int novoId = geraProximoId(gerador);
         Forma clone = clonaForma(original, dx, dy, novoId);
         if (clone) {
-            insereListaFim(formas, clone);
+            registraFormaDiff(diff, clone);
+            insereFormaVista(cenario, formas, clone);
         }
     }
     destroiLista(clones);
@@ -258,149 +267,803 @@ void obterDimensoesMaximas(Lista formas, double *wMax, double *hMax) {
     *wMax += 50.0; *hMax += 50.0;
 }
 
-// --- MAIN PROCESS ---
+// --- COMANDOS ---
 
-void processaArquivoQry(const char* entrada, Lista formas, Gerador gerador, const char* dirSaida, const char* nomeBase, char tipoSort, int threshold) {
-    FILE* qry = fopen(entrada, "r");
-    if (!qry) {
-        printf("ERRO: Nao abriu QRY: %s\n", entrada);
-        return;
-    }
+#define MAX_LINHA_QRY 512
+#define CAPACIDADE_CACHE_VIS 16
+#define MAX_MARCAS 16
 
-    // --- CRIAÇÃO DO ARQUIVO TXT DE RELATÓRIO ---
-    char nomeTxt[1024], pathTxt[1024];
-    sprintf(nomeTxt, "%s.txt", nomeBase); 
-    montaCaminhoFile(pathTxt, dirSaida, nomeTxt);
-    
-    FILE* txtLog = fopen(pathTxt, "w"); 
+typedef struct {
+    char nome[10];              // d, p, cln, a
+    char linha[MAX_LINHA_QRY];  // linha original do .qry
+    double bx, by;              // posição da bomba (d, p, cln)
+    PoligonoVis poligono;       // visibilidade calculada antes da aplicação
+    int mesmaPosicao;           // bomba anterior do lote na mesma posição, ou -1
+    bool calculado;             // polígono calculado neste lote (não veio do cache)
+    PoligonoVis anterior;       // polígono de uma época anterior, a ser reparado
+    unsigned long epocaAnterior;
+} ComandoQry;
+
+// Posição de bomba como chave: 0.0 e -0.0 são a mesma posição (==), então
+// o hash usa os bits do valor normalizado
+typedef struct {
+    double x, y;
+} PosicaoBomba;
 
+static inline uint32_t hashPosicao(const PosicaoBomba *p) {
+    double x = (p->x == 0.0) ? 0.0 : p->x;
+    double y = (p->y == 0.0) ? 0.0 : p->y;
+    uint64_t bx, by;
+    memcpy(&bx, &x, sizeof(bx));
+    memcpy(&by, &y, sizeof(by));
+    return mapaHashInt((uint32_t) (bx ^ (bx >> 32)) ^ mapaHashInt((uint32_t) (by ^ (by >> 32))));
+}
+
+#define HASH_POSICAO(p) hashPosicao(p)
+#define IGUAL_POSICAO(a, b) ((a)->x == (b)->x && (a)->y == (b)->y)
+
+// Posição -> índice da primeira bomba do lote nela
+MAPA_DEFINE(MapaPosicoes, PosicaoBomba, int, HASH_POSICAO, IGUAL_POSICAO)
+
+// Instantâneo do cenário para desfazer (ver marcaSessaoQry)
+typedef struct {
+    Cenario cenario;
+    unsigned long epoca;
+} MarcaCenario;
+
+// Estado compartilhado durante o processamento de um .qry
+typedef struct {
+    Cenario cenario;                // formas (persistente; instantâneos em O(1))
+    Lista formas;                   // vista do cenário, refeita após cada comando
+    MarcaCenario marcas[MAX_MARCAS];
+    int qtdMarcas;
+    Gerador gerador;
+    const char *dirSaida;
+    const char *nomeBase;
+    char tipoSort;
+    int threshold;
+    int numThreads;
+    PoolThreads poolPorBomba;   // ctx->pool quando o lote tem uma única bomba
+    FILE *txtLog;
+    FILE *caminhosSvg;              // se não NULL, recebe o caminho de cada SVG gerado
+    PoolThreads pool;
     double maxW, maxH;
-    obterDimensoesMaximas(formas, &maxW, &maxH);
+    unsigned long epocaSegmentos;   // muda sempre que os obstáculos mudam
+    DiffSegmentos *diario;          // diario[e]: segmentos alterados da época e para e+1
+    int capDiario;
+    bool diarioValido;              // false se o diário se perdeu (sem reparos)
+    CacheVis cache;
+    long reparos;                   // polígonos reparados em vez de recalculados
+    long repetidas;                 // bombas servidas pela primeira do lote na mesma posição
+    char motorVis;                  // 's' varredura, 't' expansão triangular
+    Triangulacao tri;               // triangulação dos obstáculos (motor 't')
+    unsigned long epocaTri;         // época em que 'tri' foi construída
+    int construcoesTri;
+    double toleranciaSimp;          // < 0: polígonos usados como calculados
+    bool gerarSvg;
+    bool aplicarEfeitos;            // false: simulação, o cenário não muda
+    long verticesAntes, verticesDepois;
+} ContextoQry;
 
-    char linha[512];
+typedef struct {
+    ComandoQry *cmd;
+    ContextoQry *ctx;
+} TarefaVisibilidade;
 
-    while (fgets(linha, sizeof(linha), qry)) {
-        char comando[10];
-        if (sscanf(linha, "%s", comando) != 1) continue;
+static bool comandoEhBomba(const ComandoQry *cmd) {
+    return strcmp(cmd->nome, "d") == 0 || strcmp(cmd->nome, "p") == 0 ||
+           strcmp(cmd->nome, "cln") == 0;
+}
 
-        // === d: DESTRUIÇÃO ===
-        if (strcmp(comando, "d") == 0) {
-            double bx, by;
-            char sufixo[256] = "";
-            sscanf(linha, "d %lf %lf %s", &bx, &by, sufixo);
-            
-            if(txtLog) fprintf(txtLog, "d %f %f %s\n\n", bx, by, sufixo);
+// Comandos que alteram os segmentos do cenário (obstáculos)
+static bool comandoAlteraSegmentos(const ComandoQry *cmd) {
+    return strcmp(cmd->nome, "d") == 0 || strcmp(cmd->nome, "cln") == 0 ||
+           strcmp(cmd->nome, "a") == 0;
+}
 
-            Lista poli = calcular_visibilidade(bx, by, formas, tipoSort, threshold);
-            
-            char nomeArq[1024], pathSvg[1024];
-            sprintf(nomeArq, "%s-d-%s.svg", nomeBase, (strlen(sufixo)>0)?sufixo:"idx");
-            montaCaminhoFile(pathSvg, dirSaida, nomeArq);
-            FILE* svg = fopen(pathSvg, "w");
-            if(svg) {
-                fprintf(svg, "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%.2f\" height=\"%.2f\">\n", maxW, maxH);
-                fprintf(svg, "\t<rect x=\"0\" y=\"0\" width=\"%.2f\" height=\"%.2f\" fill=\"none\" stroke=\"black\" stroke-width=\"1\" />\n", maxW, maxH);
-                escreveFormasSVG(svg, formas);
-                desenhar_poligono_visibilidade(svg, poli, "red");
-                fprintf(svg, "<circle cx=\"%.2f\" cy=\"%.2f\" r=\"5\" fill=\"red\" stroke=\"black\" stroke-width=\"1\"/>\n", bx, by);
-                fprintf(svg, "</svg>");
-                fclose(svg);
+// Lê todas as linhas do .qry para um vetor de comandos; NULL se faltar memória
+// (o arquivo inteiro ou nada: um script truncado não é executado)
+static ComandoQry* leComandosQry(FILE *qry, int *qtd) {
+    int capacidade = 64;
+    int n = 0;
+    ComandoQry *cmds = malloc(capacidade * sizeof(ComandoQry));
+    char linha[MAX_LINHA_QRY];
+
+    while (cmds && fgets(linha, sizeof(linha), qry)) {
+        char comando[10];
+        if (sscanf(linha, "%9s", comando) != 1) continue;
+
+        if (n >= capacidade) {
+            capacidade *= 2;
+            ComandoQry *novo = realloc(cmds, capacidade * sizeof(ComandoQry));
+            if (!novo) {
+                // Sem memória para o resto do arquivo: não executa um script truncado
+                free(cmds);
+                return NULL;
             }
-            
-            aplicarDestruicao(formas, poli, txtLog);
-            destruir_lista_pontos(poli);
+            cmds = novo;
         }
+
+        ComandoQry *cmd = &cmds[n++];
+        strcpy(cmd->nome, comando);
+        strcpy(cmd->linha, linha);
+        cmd->bx = cmd->by = 0.0;
+        cmd->poligono = NULL;
+        cmd->mesmaPosicao = -1;
+        cmd->calculado = false;
+        cmd->anterior = NULL;
+        cmd->epocaAnterior = 0;
+        if (comandoEhBomba(cmd)) {
+            sscanf(linha, "%*s %lf %lf", &cmd->bx, &cmd->by);
+        }
+    }
+
+    *qtd = n;
+    return cmds;
+}
+
+/*
+ * Delimita o próximo lote de comandos a partir de 'inicio'.
+ * Dentro de um lote os segmentos do cenário não mudam, então os polígonos
+ * de todas as bombas do lote podem ser calculados ao mesmo tempo: o lote
+ * termina logo após o primeiro comando que altera segmentos (d, cln),
+ * ou antes de um 'a' (que forma um lote sozinho).
+ * Retorna o índice do primeiro comando fora do lote.
+ */
+static int fimDoLote(ComandoQry *cmds, int qtd, int inicio) {
+    int j = inicio;
+    while (j < qtd) {
+        ComandoQry *cmd = &cmds[j];
+        if (comandoAlteraSegmentos(cmd)) {
+            if (comandoEhBomba(cmd) || j == inicio) j++;
+            break;
+        }
+        j++;
+    }
+    return j;
+}
+
+// Polígono de (bx, by) com o motor escolhido nas opções
+static PoligonoVis calculaPoligono(ContextoQry *ctx, double bx, double by, PoolThreads pool) {
+    if (ctx->motorVis == 't' && ctx->tri) {
+        return calcular_visibilidade_triangulacao(ctx->tri, bx, by, ctx->formas, ctx->tipoSort, ctx->threshold);
+    }
+    return calcular_visibilidade_paralela(bx, by, ctx->formas, ctx->tipoSort, ctx->threshold, pool);
+}
+
+static void tarefaCalculaVisibilidade(void *arg) {
+    TarefaVisibilidade *t = (TarefaVisibilidade*) arg;
+    ContextoQry *ctx = t->ctx;
+    ComandoQry *cmd = t->cmd;
+
+    if (cmd->anterior) {
+        // Só os intervalos angulares dos segmentos alterados desde então
+        cmd->poligono = reparar_visibilidade(cmd->bx, cmd->by, ctx->formas, cmd->anterior,
+                                             &ctx->diario[cmd->epocaAnterior],
+                                             (int)(ctx->epocaSegmentos - cmd->epocaAnterior),
+                                             ctx->tipoSort, ctx->threshold);
+        cmd->anterior = NULL;
+        return;
+    }
+    cmd->poligono = calculaPoligono(ctx, cmd->bx, cmd->by, ctx->poolPorBomba);
+}
+
+// Triangulação dos obstáculos da época atual (só reconstrói se eles mudaram)
+static void atualizaTriangulacao(ContextoQry *ctx) {
+    if (ctx->tri && ctx->epocaTri == ctx->epocaSegmentos) return;
+
+    destroiTriangulacao(ctx->tri);
+    ctx->tri = preparar_triangulacao(ctx->formas);
+    ctx->epocaTri = ctx->epocaSegmentos;
+    ctx->construcoesTri++;
+}
+
+// Sem o diário completo os polígonos antigos não podem mais ser reparados
+// (só recalculados): descarta o que foi guardado
+static void descartaDiario(ContextoQry *ctx, const char *motivo) {
+    fprintf(stderr, "ERRO: %s; reparos desativados.\n", motivo);
+    ctx->diarioValido = false;
+    for (unsigned long e = 0; e < ctx->epocaSegmentos; e++) {
+        destroiDiffSegmentos(ctx->diario[e]);
+    }
+}
+
+// Fecha a época atual: guarda no diário os segmentos alterados e avança a época
+static void avancaEpoca(ContextoQry *ctx, DiffSegmentos diff) {
+    if (ctx->diarioValido && !diffCompleto(diff)) {
+        descartaDiario(ctx, "falha ao registrar segmentos alterados");
+    }
+    if (ctx->diarioValido && ctx->epocaSegmentos >= (unsigned long) ctx->capDiario) {
+        int novaCap = (ctx->capDiario == 0) ? 16 : ctx->capDiario * 2;
+        DiffSegmentos *novo = realloc(ctx->diario, novaCap * sizeof(DiffSegmentos));
+        if (!novo) {
+            descartaDiario(ctx, "falha ao expandir diario de segmentos");
+        } else {
+            ctx->diario = novo;
+            ctx->capDiario = novaCap;
+        }
+    }
+
+    if (ctx->diarioValido) {
+        ctx->diario[ctx->epocaSegmentos] = diff;
+    } else {
+        destroiDiffSegmentos(diff);
+    }
+    ctx->epocaSegmentos++;
+}
+
+// Refaz a vista (lista) inteira: ao trocar de versão do cenário (desfaz) ou
+// se a vista deixou de acompanhá-lo (falha ao inserir nela)
+static void atualizaVista(ContextoQry *ctx) {
+    Lista vista = listaFormasCenario(ctx->cenario);
+    if (!vista) {
+        fprintf(stderr, "ERRO: falha ao montar a lista de formas; mantida a anterior.\n");
+        return;
+    }
+    destroiLista(ctx->formas);
+    ctx->formas = vista;
+}
+
+// Cria o SVG de uma bomba: formas atuais + polígono + marcador da bomba
+static void geraSvgBomba(ContextoQry *ctx, const char *tipo, const char *sufixo, PoligonoVis poli, double bx, double by, const char *cor, const char *extraMarcador) {
+    if (!ctx->gerarSvg) return;
+
+    char nomeArq[1024], pathSvg[1024];
+    sprintf(nomeArq, "%s-%s-%s.svg", ctx->nomeBase, tipo, (strlen(sufixo)>0)?sufixo:"idx");
+    montaCaminhoFile(pathSvg, ctx->dirSaida, nomeArq);
+    FILE* svg = fopen(pathSvg, "w");
+    if(svg) {
+        fprintf(svg, "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%.2f\" height=\"%.2f\">\n", ctx->maxW, ctx->maxH);
+        fprintf(svg, "\t<rect x=\"0\" y=\"0\" width=\"%.2f\" height=\"%.2f\" fill=\"none\" stroke=\"black\" stroke-width=\"1\" />\n", ctx->maxW, ctx->maxH);
+        escreveFormasSVG(svg, ctx->formas);
+        desenhar_poligono_visibilidade(svg, poli, (char*)cor);
+        fprintf(svg, "<circle cx=\"%.2f\" cy=\"%.2f\" r=\"5\" fill=\"%s\" stroke=\"black\"%s/>\n", bx, by, cor, extraMarcador);
+        fprintf(svg, "</svg>");
+        fclose(svg);
+        if (ctx->caminhosSvg) fprintf(ctx->caminhosSvg, "svg: %s\n", pathSvg);
+    }
+}
+
+// Simulação: relata as formas que o polígono atingiria, sem alterá-las
+static void relataAtingidas(ContextoQry *ctx, PoligonoVis poligono, char *titulo) {
+    if (!ctx->txtLog) return;
+
+    int qtd = tamanhoLista(ctx->formas);
+    for (int i = 0; i < qtd; i++) {
+        Forma f = (Forma) getListaPosicao(ctx->formas, i);
+        if (formaNoPoligonoVis(f, poligono)) {
+            relatarForma(ctx->txtLog, f, titulo);
+        }
+    }
+}
+
+// Aplica os efeitos de um comando, na ordem do arquivo
+static void aplicaComando(ContextoQry *ctx, ComandoQry *cmd) {
+    const char *linha = cmd->linha;
+    FILE *txtLog = ctx->txtLog;
+    Lista formas = ctx->formas;
+    Gerador gerador = ctx->gerador;
+
+    // === d: DESTRUIÇÃO ===
+    if (strcmp(cmd->nome, "d") == 0) {
+        double bx, by;
+        char sufixo[256] = "";
+        sscanf(linha, "d %lf %lf %s", &bx, &by, sufixo);
         
-        // === p: PINTURA ===
-        else if (strcmp(comando, "p") == 0) {
-            double bx, by;
-            char cor[128], sufixo[256] = "";
-            sscanf(linha, "p %lf %lf %s %s", &bx, &by, cor, sufixo);
-            
-            if(txtLog) fprintf(txtLog, "p %f %f %s %s\n\n", bx, by, cor, sufixo);
-
-            Lista poli = calcular_visibilidade(bx, by, formas, tipoSort, threshold);
-            char nomeArq[1024], pathSvg[1024];
-            sprintf(nomeArq, "%s-p-%s.svg", nomeBase, (strlen(sufixo)>0)?sufixo:"idx");
-            montaCaminhoFile(pathSvg, dirSaida, nomeArq);
-            FILE* svg = fopen(pathSvg, "w");
-            if(svg) {
-                fprintf(svg, "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%.2f\" height=\"%.2f\">\n", maxW, maxH);
-                fprintf(svg, "\t<rect x=\"0\" y=\"0\" width=\"%.2f\" height=\"%.2f\" fill=\"none\" stroke=\"black\" stroke-width=\"1\" />\n", maxW, maxH);
-                escreveFormasSVG(svg, formas);
-                desenhar_poligono_visibilidade(svg, poli, cor);
-                fprintf(svg, "<circle cx=\"%.2f\" cy=\"%.2f\" r=\"5\" fill=\"%s\" stroke=\"black\"/>\n", bx, by, cor);
-                fprintf(svg, "</svg>");
-                fclose(svg);
-            }
-            aplicarPintura(formas, poli, cor);
-            destruir_lista_pontos(poli);
+        if(txtLog) fprintf(txtLog, "d %f %f %s\n\n", bx, by, sufixo);
+
+        geraSvgBomba(ctx, "d", sufixo, cmd->poligono, bx, by, "red", " stroke-width=\"1\"");
+        if (!ctx->aplicarEfeitos) {
+            relataAtingidas(ctx, cmd->poligono, " SERIA DESTRUÍDA: ");
+            return;
+        }
+        DiffSegmentos diff = criaDiffSegmentos();
+        if (aplicarDestruicao(ctx->cenario, formas, cmd->poligono, txtLog, diff) > 0) {
+            avancaEpoca(ctx, diff);
+        } else {
+            destroiDiffSegmentos(diff);
         }
+    }
+    
+    // === p: PINTURA ===
+    else if (strcmp(cmd->nome, "p") == 0) {
+        double bx, by;
+        char cor[128], sufixo[256] = "";
+        sscanf(linha, "p %lf %lf %s %s", &bx, &by, cor, sufixo);
+        
+        if(txtLog) fprintf(txtLog, "p %f %f %s %s\n\n", bx, by, cor, sufixo);
 
-        // === cln: CLONAGEM ===
-        else if (strcmp(comando, "cln") == 0) {
-            double bx, by, dx, dy;
-            char sufixo[256] = "";
-            sscanf(linha, "cln %lf %lf %lf %lf %s", &bx, &by, &dx, &dy, sufixo);
-            
-            if(txtLog) fprintf(txtLog, "cln %f %f %f %f %s\n\n", bx, by, dx, dy, sufixo);
-
-            Lista poli = calcular_visibilidade(bx, by, formas, tipoSort, threshold);
-            char nomeArq[1024], pathSvg[1024];
-            sprintf(nomeArq, "%s-cln-%s.svg", nomeBase, (strlen(sufixo)>0)?sufixo:"idx");
-            montaCaminhoFile(pathSvg, dirSaida, nomeArq);
-            FILE* svg = fopen(pathSvg, "w");
-            if(svg) {
-                fprintf(svg, "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%.2f\" height=\"%.2f\">\n", maxW, maxH);
-                fprintf(svg, "\t<rect x=\"0\" y=\"0\" width=\"%.2f\" height=\"%.2f\" fill=\"none\" stroke=\"black\" stroke-width=\"1\" />\n", maxW, maxH);
-                escreveFormasSVG(svg, formas);
-                desenhar_poligono_visibilidade(svg, poli, "blue"); 
-                fprintf(svg, "<circle cx=\"%.2f\" cy=\"%.2f\" r=\"5\" fill=\"blue\" stroke=\"black\"/>\n", bx, by);
-                fprintf(svg, "</svg>");
-                fclose(svg);
-            }
-            aplicarClonagem(formas, poli, dx, dy, gerador);
-            destruir_lista_pontos(poli);
+        geraSvgBomba(ctx, "p", sufixo, cmd->poligono, bx, by, cor, "");
+        if (!ctx->aplicarEfeitos) {
+            relataAtingidas(ctx, cmd->poligono, " SERIA PINTADA: ");
+            return;
+        }
+        aplicarPintura(ctx->cenario, formas, cmd->poligono, cor);
+    }
+
+    // === cln: CLONAGEM ===
+    else if (strcmp(cmd->nome, "cln") == 0) {
+        double bx, by, dx, dy;
+        char sufixo[256] = "";
+        sscanf(linha, "cln %lf %lf %lf %lf %s", &bx, &by, &dx, &dy, sufixo);
+        
+        if(txtLog) fprintf(txtLog, "cln %f %f %f %f %s\n\n", bx, by, dx, dy, sufixo);
+
+        geraSvgBomba(ctx, "cln", sufixo, cmd->poligono, bx, by, "blue", "");
+        if (!ctx->aplicarEfeitos) {
+            relataAtingidas(ctx, cmd->poligono, " SERIA CLONADA: ");
+            return;
         }
+        DiffSegmentos diff = criaDiffSegmentos();
+        aplicarClonagem(ctx->cenario, formas, cmd->poligono, dx, dy, gerador, diff);
+        avancaEpoca(ctx, diff);
+    }
 
-        // === a: ANTEPARO ===
-        else if (strcmp(comando, "a") == 0) {
-             int id;
-             char orientacao[10] = ""; 
-             int lidos = sscanf(linha, "a %d %s", &id, orientacao);
-             
-             if (lidos >= 1) {
-                if(txtLog) fprintf(txtLog, "a %d %s\n\n", id, orientacao);
-
-                char ori = (strlen(orientacao) > 0) ? orientacao[0] : 'i';
-                int qtd = tamanhoLista(formas);
-                int tamanhoAntes = qtd; 
-
-                for(int i=0; i<qtd; i++) {
-                    Forma f = (Forma)getListaPosicao(formas, i);
-                    if(f && getFormaId(f) == id) {
-                        
-                        if (txtLog) {
-                            relatarForma(txtLog, f, "- TRANSFORMAÇÃO DE FORMA EM ANTEPARO - ORIGINAL:");
-                        }
-
-                        transformaEmAnteparo(f, ori, gerador, formas);
-                        
-                        if (txtLog) {
-                             fprintf(txtLog, "- NOVOS ANTEPAROS: \n");
-                             int tamanhoDepois = tamanhoLista(formas);
-                             for(int k = tamanhoAntes - 1; k < tamanhoDepois; k++) {
-                                 Forma novaF = getListaPosicao(formas, k);
-                                 relatarForma(txtLog, novaF, NULL);
-                             }
-                        }
+    // === a: ANTEPARO ===
+    else if (strcmp(cmd->nome, "a") == 0) {
+         int id;
+         char orientacao[10] = ""; 
+         int lidos = sscanf(linha, "a %d %s", &id, orientacao);
+         
+         if (lidos >= 1) {
+            if(txtLog) fprintf(txtLog, "a %d %s\n\n", id, orientacao);
+
+            char ori = (strlen(orientacao) > 0) ? orientacao[0] : 'i';
+            int qtd = tamanhoLista(formas);
+            int tamanhoAntes = qtd; 
+
+            for(int i=0; i<qtd; i++) {
+                Forma f = (Forma)getListaPosicao(formas, i);
+                if(f && getFormaId(f) == id) {
+                    
+                    if (!ctx->aplicarEfeitos) {
+                        relatarForma(txtLog, f, "- SERIA TRANSFORMADA EM ANTEPARO:");
                         break;
                     }
+                    if (txtLog) {
+                        relatarForma(txtLog, f, "- TRANSFORMAÇÃO DE FORMA EM ANTEPARO - ORIGINAL:");
+                    }
+
+                    // Só a linha é alterada (vira anteparo); as outras formas ganham
+                    // segmentos novos, inseridos no fim do cenário
+                    Forma alvo = (getFormaTipo(f) == TIPO_LINHA) ? formaMutavelVista(ctx->cenario, formas, i) : f;
+                    Lista novas = criaLista();
+                    transformaEmAnteparo(alvo, ori, gerador, novas);
+                    int qtdNovas = tamanhoLista(novas);
+                    for (int k = 0; k < qtdNovas; k++) {
+                        insereFormaVista(ctx->cenario, formas, getListaPosicao(novas, k));
+                    }
+                    destroiLista(novas);
+
+                    // Os anteparos novos entram no fim da lista. Uma linha vira
+                    // anteparo sem mudar de segmento: nada entra no diff e a
+                    // época continua a mesma (os polígonos do cache seguem válidos)
+                    DiffSegmentos diff = criaDiffSegmentos();
+                    int tamanhoDepois = tamanhoLista(formas);
+                    int alterados = 0;
+                    for(int k = tamanhoAntes; k < tamanhoDepois; k++) {
+                        alterados += registraFormaDiff(diff, getListaPosicao(formas, k));
+                    }
+                    if (alterados > 0) {
+                        avancaEpoca(ctx, diff);
+                    } else {
+                        destroiDiffSegmentos(diff);
+                    }
+                    
+                    if (txtLog) {
+                         fprintf(txtLog, "- NOVOS ANTEPAROS: \n");
+                         for(int k = tamanhoAntes - 1; k < tamanhoDepois; k++) {
+                             Forma novaF = getListaPosicao(formas, k);
+                             relatarForma(txtLog, novaF, NULL);
+                         }
+                    }
+                    break;
                 }
-             }
+            }
+         }
+    }
+}
+
+// --- SESSÃO ---
+
+SessaoQry criaSessaoQry(Lista formas, Gerador gerador, const char* dirSaida, Opcoes opcoes) {
+    ContextoQry *ctx = malloc(sizeof(ContextoQry));
+    if (!ctx) return NULL;
+
+    ctx->cenario = criaCenarioDeLista(formas);
+    ctx->formas = listaFormasCenario(ctx->cenario);
+    if (!ctx->cenario || !ctx->formas) {
+        destroiCenario(ctx->cenario);
+        destroiLista(ctx->formas);
+        free(ctx);
+        return NULL;
+    }
+    ctx->qtdMarcas = 0;
+    ctx->gerador = gerador;
+    ctx->dirSaida = dirSaida;
+    ctx->nomeBase = NULL;
+    ctx->tipoSort = getTipoSortOpcoes(opcoes);
+    ctx->threshold = getThresholdOpcoes(opcoes);
+    ctx->numThreads = getNumThreadsOpcoes(opcoes);
+    ctx->poolPorBomba = NULL;
+    ctx->txtLog = NULL;
+    ctx->caminhosSvg = NULL;
+    ctx->pool = criaPoolThreads(ctx->numThreads);
+    ctx->maxW = ctx->maxH = 0.0;
+    ctx->epocaSegmentos = 0;
+    ctx->diario = NULL;
+    ctx->capDiario = 0;
+    ctx->diarioValido = true;
+    ctx->cache = criaCacheVis(CAPACIDADE_CACHE_VIS);
+    ctx->reparos = 0;
+    ctx->repetidas = 0;
+    ctx->motorVis = getMotorVisOpcoes(opcoes);
+    ctx->tri = NULL;
+    ctx->epocaTri = 0;
+    ctx->construcoesTri = 0;
+    ctx->toleranciaSimp = getToleranciaSimpOpcoes(opcoes);
+    ctx->gerarSvg = getGerarSvgOpcoes(opcoes);
+    ctx->aplicarEfeitos = getAplicarEfeitosOpcoes(opcoes);
+    ctx->verticesAntes = 0;
+    ctx->verticesDepois = 0;
+    return ctx;
+}
+
+void preparaIndicesSessaoQry(SessaoQry s) {
+    ContextoQry *ctx = (ContextoQry*) s;
+    if (!ctx) return;
+    if (ctx->motorVis == 't') atualizaTriangulacao(ctx);
+}
+
+int executaComandosSessaoQry(SessaoQry s, FILE* comandos, const char* nomeBase, FILE* relatorio, FILE* caminhosSvg) {
+    ContextoQry *ctx = (ContextoQry*) s;
+    if (!ctx || !comandos) return -1;
+
+    int qtdCmds = 0;
+    ComandoQry *cmds = leComandosQry(comandos, &qtdCmds);
+    if (!cmds) {
+        fprintf(stderr, "ERRO: falha ao alocar comandos do QRY; nenhum comando executado.\n");
+        return -1;
+    }
+    TarefaVisibilidade *tarefas = malloc((qtdCmds > 0 ? qtdCmds : 1) * sizeof(TarefaVisibilidade));
+    if (!tarefas) {
+        fprintf(stderr, "ERRO: falha ao alocar tarefas do QRY.\n");
+        free(cmds);
+        return -1;
+    }
+
+    ctx->nomeBase = nomeBase;
+    ctx->txtLog = relatorio;
+    ctx->caminhosSvg = caminhosSvg;
+    obterDimensoesMaximas(ctx->formas, &ctx->maxW, &ctx->maxH);
+
+    MapaPosicoes posicoes;
+    MapaPosicoes_inicia(&posicoes);
+
+    int inicio = 0;
+    while (inicio < qtdCmds) {
+        // Na simulação nada altera os segmentos: o arquivo inteiro é um lote
+        int fim = ctx->aplicarEfeitos ? fimDoLote(cmds, qtdCmds, inicio) : qtdCmds;
+
+        // 1. Polígonos do lote (independentes entre si). Bombas repetidas no
+        //    lote esperam a primeira; as demais tentam o cache antes de calcular.
+        int bombas = 0;
+        MapaPosicoes_limpa(&posicoes);
+        for (int i = inicio; i < fim; i++) {
+            ComandoQry *cmd = &cmds[i];
+            if (!comandoEhBomba(cmd)) continue;
+
+            PosicaoBomba pos = { cmd->bx, cmd->by };
+            int *primeira = MapaPosicoes_busca(&posicoes, pos);
+            if (primeira) {
+                cmd->mesmaPosicao = *primeira;
+                continue;
+            }
+            MapaPosicoes_insere(&posicoes, pos, i);
+
+            cmd->poligono = buscaCacheVis(ctx->cache, cmd->bx, cmd->by, ctx->epocaSegmentos);
+            if (!cmd->poligono) {
+                // Polígono da mesma posição em época anterior: repara em vez de recalcular
+                // (o reparo reproduz a varredura, então só vale para esse motor)
+                if (ctx->diarioValido && ctx->motorVis == 's') {
+                    cmd->anterior = buscaCacheVisRecente(ctx->cache, cmd->bx, cmd->by, ctx->epocaSegmentos, &cmd->epocaAnterior);
+                    if (cmd->anterior) ctx->reparos++;
+                }
+                cmd->calculado = true;
+                bombas++;
+            }
         }
+
+        //    Com uma única bomba a calcular, as threads do pool dividem o
+        //    próprio cálculo em fatias angulares: a tarefa roda nesta thread,
+        //    que distribui as fatias (e não dentro de uma tarefa do pool).
+        ctx->poolPorBomba = (bombas == 1) ? ctx->pool : NULL;
+
+        //    A triangulação é compartilhada (só leitura) pelas tarefas do lote.
+        if (ctx->motorVis == 't' && bombas > 0) {
+            atualizaTriangulacao(ctx);
+        }
+
+        for (int i = inicio; i < fim; i++) {
+            if (!cmds[i].calculado) continue;
+            tarefas[i].cmd = &cmds[i];
+            tarefas[i].ctx = ctx;
+            if (ctx->poolPorBomba != NULL ||
+                !submetePoolThreads(ctx->pool, tarefaCalculaVisibilidade, &tarefas[i])) {
+                tarefaCalculaVisibilidade(&tarefas[i]);
+            }
+        }
+        aguardaPoolThreads(ctx->pool);
+
+        for (int i = inicio; i < fim; i++) {
+            ComandoQry *cmd = &cmds[i];
+            if (cmd->calculado) {
+                insereCacheVis(ctx->cache, cmd->bx, cmd->by, ctx->epocaSegmentos, cmd->poligono);
+            } else if (cmd->mesmaPosicao >= 0) {
+                // Cópia do polígono da primeira bomba (os segmentos não mudam
+                // dentro do lote); sem obstáculos ela também não tem polígono.
+                // Não passa pelo cache: conta como acerto, nunca como falha.
+                PoligonoVis primeiro = cmds[cmd->mesmaPosicao].poligono;
+                cmd->poligono = primeiro ? copiaPoligonoVis(primeiro) : NULL;
+                ctx->repetidas++;
+            }
+        }
+
+        // 2. Efeitos, sempre na ordem do arquivo. A simplificação é feita
+        //    na cópia do comando: o cache (e o reparo) usam o polígono cheio.
+        for (int i = inicio; i < fim; i++) {
+            if (ctx->toleranciaSimp >= 0.0 && cmds[i].poligono) {
+                ctx->verticesAntes += getQtdVerticesPoligonoVis(cmds[i].poligono);
+                simplificaPoligonoVis(cmds[i].poligono, ctx->toleranciaSimp);
+                ctx->verticesDepois += getQtdVerticesPoligonoVis(cmds[i].poligono);
+            }
+            aplicaComando(ctx, &cmds[i]);
+            if (tamanhoLista(ctx->formas) != getQtdFormasCenario(ctx->cenario)) {
+                atualizaVista(ctx);
+            }
+            if (cmds[i].poligono) {
+                destroiPoligonoVis(cmds[i].poligono);
+                cmds[i].poligono = NULL;
+            }
+        }
+
+        inicio = fim;
     }
-    
-    if (txtLog) fclose(txtLog);
+
+    ctx->nomeBase = NULL;
+    ctx->txtLog = NULL;
+    ctx->caminhosSvg = NULL;
+    MapaPosicoes_libera(&posicoes);
+    free(tarefas);
+    free(cmds);
+    return qtdCmds;
+}
+
+// --- AVALIAÇÃO DE SÍTIOS ---
+
+#define QTD_TIPOS_FORMA 4
+
+// Um ponto candidato e quantas formas de cada tipo seu polígono atinge
+typedef struct {
+    double x, y;
+    int atingidas[QTD_TIPOS_FORMA];   // indexado por TipoForma
+    int total;
+    ContextoQry *ctx;
+} SitioCandidato;
+
+typedef struct {
+    SitioCandidato *sitio;
+    PoligonoVis poligono;
+} ContagemSitio;
+
+static void contaFormaSitio(void *dado, void *contexto) {
+    ContagemSitio *c = (ContagemSitio*) contexto;
+    Forma f = (Forma) dado;
+    if (formaNoPoligonoVis(f, c->poligono)) {
+        c->sitio->atingidas[getFormaTipo(f)]++;
+        c->sitio->total++;
+    }
+}
+
+// Tarefa do pool: polígono do sítio, contagem e descarte (nada é guardado)
+static void tarefaAvaliaSitio(void *arg) {
+    SitioCandidato *sitio = (SitioCandidato*) arg;
+    ContextoQry *ctx = sitio->ctx;
+
+    PoligonoVis poligono = calculaPoligono(ctx, sitio->x, sitio->y, NULL);
+    if (!poligono) return;
+    if (ctx->toleranciaSimp >= 0.0) {
+        simplificaPoligonoVis(poligono, ctx->toleranciaSimp);
+    }
+
+    // Uma passada sequencial (percorreLista só lê a lista: várias tarefas
+    // podem percorrê-la ao mesmo tempo)
+    ContagemSitio contagem = { sitio, poligono };
+    percorreLista(ctx->formas, contaFormaSitio, &contagem);
+    destroiPoligonoVis(poligono);
+}
+
+// Lê pontos "x y" (uma linha cada; linhas vazias e '#' são ignoradas)
+static SitioCandidato* leSitios(FILE *pontos, int *qtd) {
+    int capacidade = 64;
+    int n = 0;
+    SitioCandidato *sitios = malloc(capacidade * sizeof(SitioCandidato));
+    char linha[MAX_LINHA_QRY];
+
+    while (sitios && fgets(linha, sizeof(linha), pontos)) {
+        double x, y;
+        char primeiro[2];
+        if (sscanf(linha, "%1s", primeiro) != 1 || primeiro[0] == '#') continue;
+        if (sscanf(linha, "%lf %lf", &x, &y) != 2) {
+            fprintf(stderr, "Aviso: linha de sitio ignorada: %s", linha);
+            continue;
+        }
+
+        if (n >= capacidade) {
+            capacidade *= 2;
+            SitioCandidato *novo = realloc(sitios, capacidade * sizeof(SitioCandidato));
+            if (!novo) break;
+            sitios = novo;
+        }
+        SitioCandidato *sitio = &sitios[n++];
+        memset(sitio, 0, sizeof(SitioCandidato));
+        sitio->x = x;
+        sitio->y = y;
+    }
+
+    *qtd = n;
+    return sitios;
+}
+
+int avaliaSitiosSessaoQry(SessaoQry s, FILE* pontos, FILE* relatorio) {
+    ContextoQry *ctx = (ContextoQry*) s;
+    if (!ctx || !pontos) return -1;
+
+    int qtd = 0;
+    SitioCandidato *sitios = leSitios(pontos, &qtd);
+    if (!sitios) {
+        fprintf(stderr, "ERRO: falha ao alocar sitios candidatos.\n");
+        return -1;
+    }
+
+    // Os sítios não alteram o cenário: todos são independentes e dividem
+    // o pool (uma thread por sítio); a triangulação é construída uma vez
+    if (ctx->motorVis == 't') atualizaTriangulacao(ctx);
+    for (int i = 0; i < qtd; i++) {
+        sitios[i].ctx = ctx;
+        if (!submetePoolThreads(ctx->pool, tarefaAvaliaSitio, &sitios[i])) {
+            tarefaAvaliaSitio(&sitios[i]);
+        }
+    }
+    aguardaPoolThreads(ctx->pool);
+
+    int melhor = -1;
+    if (relatorio) fprintf(relatorio, "# x y total circulos retangulos linhas textos\n");
+    for (int i = 0; i < qtd; i++) {
+        SitioCandidato *sitio = &sitios[i];
+        if (relatorio) {
+            fprintf(relatorio, "%f %f %d %d %d %d %d\n", sitio->x, sitio->y, sitio->total,
+                    sitio->atingidas[TIPO_CIRCULO], sitio->atingidas[TIPO_RETANGULO],
+                    sitio->atingidas[TIPO_LINHA], sitio->atingidas[TIPO_TEXTO]);
+        }
+        if (melhor < 0 || sitio->total > sitios[melhor].total) melhor = i;
+    }
+    if (melhor >= 0) {
+        printf("Sitios: %d avaliados; melhor (%f, %f) atinge %d formas\n",
+               qtd, sitios[melhor].x, sitios[melhor].y, sitios[melhor].total);
+    } else {
+        printf("Sitios: nenhum ponto candidato\n");
+    }
+
+    free(sitios);
+    return qtd;
+}
+
+bool marcaSessaoQry(SessaoQry s) {
+    ContextoQry *ctx = (ContextoQry*) s;
+    if (!ctx) return false;
+
+    Cenario instantaneo = copiaCenario(ctx->cenario);
+    if (!instantaneo) return false;
+
+    // Pilha cheia: descarta a marca mais antiga
+    if (ctx->qtdMarcas == MAX_MARCAS) {
+        destroiCenario(ctx->marcas[0].cenario);
+        memmove(&ctx->marcas[0], &ctx->marcas[1], (MAX_MARCAS - 1) * sizeof(MarcaCenario));
+        ctx->qtdMarcas--;
+    }
+    ctx->marcas[ctx->qtdMarcas].cenario = instantaneo;
+    ctx->marcas[ctx->qtdMarcas].epoca = ctx->epocaSegmentos;
+    ctx->qtdMarcas++;
+    return true;
+}
+
+bool desfazSessaoQry(SessaoQry s) {
+    ContextoQry *ctx = (ContextoQry*) s;
+    if (!ctx || ctx->qtdMarcas == 0) return false;
+
+    MarcaCenario marca = ctx->marcas[--ctx->qtdMarcas];
+
+    // Voltar ao cenário da marca é mais uma mudança de época: os segmentos
+    // alterados desde ela são a união dos diffs do diário nesse intervalo
+    // (assim os polígonos do cache ainda podem ser reparados)
+    DiffSegmentos diff = criaDiffSegmentos();
+    for (unsigned long e = marca.epoca; ctx->diarioValido && e < ctx->epocaSegmentos; e++) {
+        int qtd = getQtdSegmentosDiff(ctx->diario[e]);
+        for (int k = 0; k < qtd; k++) {
+            double x1, y1, x2, y2;
+            getSegmentoDiff(ctx->diario[e], k, &x1, &y1, &x2, &y2);
+            registraSegmentoDiff(diff, x1, y1, x2, y2);
+        }
+    }
+    if (marca.epoca != ctx->epocaSegmentos) {
+        avancaEpoca(ctx, diff);
+    } else {
+        destroiDiffSegmentos(diff);  // só pinturas desde a marca
+    }
+
+    destroiCenario(ctx->cenario);
+    ctx->cenario = marca.cenario;
+    atualizaVista(ctx);
+    return true;
+}
+
+void destroiSessaoQry(SessaoQry s) {
+    ContextoQry *ctx = (ContextoQry*) s;
+    if (!ctx) return;
+
+    printf("Cache de visibilidade: %ld acertos, %ld falhas (%ld reparados)\n",
+           getAcertosCacheVis(ctx->cache) + ctx->repetidas, getFalhasCacheVis(ctx->cache), ctx->reparos);
+    if (ctx->toleranciaSimp >= 0.0) {
+        printf("Simplificacao: %ld vertices -> %ld (tolerancia %g)\n",
+               ctx->verticesAntes, ctx->verticesDepois, ctx->toleranciaSimp);
+    }
+    if (ctx->motorVis == 't') {
+        printf("Triangulacao: %d construcoes, %d triangulos, %d arestas restritas (ultima)\n",
+               ctx->construcoesTri, getQtdTriangulos(ctx->tri), getQtdArestasRestritas(ctx->tri));
+    }
+
+    for (unsigned long e = 0; ctx->diarioValido && e < ctx->epocaSegmentos; e++) {
+        destroiDiffSegmentos(ctx->diario[e]);
+    }
+    free(ctx->diario);
+    for (int i = 0; i < ctx->qtdMarcas; i++) {
+        destroiCenario(ctx->marcas[i].cenario);
+    }
+    destroiLista(ctx->formas);
+    destroiCenario(ctx->cenario);
+    destroiTriangulacao(ctx->tri);
+    destroiCacheVis(ctx->cache);
+    destroiPoolThreads(ctx->pool);
+    free(ctx);
+}
+
+// --- MAIN PROCESS ---
+
+bool processaArquivoQry(const char* entrada, Lista formas, Gerador gerador, const char* dirSaida, const char* nomeBase, Opcoes opcoes) {
+    FILE* qry = fopen(entrada, "r");
+    if (!qry) {
+        printf("ERRO: Nao abriu QRY: %s\n", entrada);
+        return false;
+    }
+
+    SessaoQry sessao = criaSessaoQry(formas, gerador, dirSaida, opcoes);
+    if (!sessao) {
+        fprintf(stderr, "ERRO: falha ao alocar sessao do QRY.\n");
+        fclose(qry);
+        return false;
+    }
+
+    // --- CRIAÇÃO DO ARQUIVO TXT DE RELATÓRIO ---
+    char nomeTxt[1024], pathTxt[1024];
+    sprintf(nomeTxt, "%s.txt", nomeBase); 
+    montaCaminhoFile(pathTxt, dirSaida, nomeTxt);
+    FILE *txtLog = fopen(pathTxt, "w");
+
+    int lidos = executaComandosSessaoQry(sessao, qry, nomeBase, txtLog, NULL);
+
     fclose(qry);
-}
\ No newline at end of file
+    destroiSessaoQry(sessao);
+    if (txtLog) fclose(txtLog);
+    return lidos >= 0;
+}
@@ -3,6 +3,9 @@
 
 #include "lista.h"
 #include "gerador.h"
+#include "opcoes.h"
+#include <stdio.h>
+#include <stdbool.h>
 
 /*
  * Processa o arquivo de consultas (.qry).
@@ -12,9 +15,123 @@
  * gerador: Gerador de IDs (caso precise criar novas formas)
  * dirSaida: Diretório para salvar os SVGs
  * nomeBase: Nome base do arquivo geo (para compor nome da saída)
- * tipoSort: 'q' ou 'm' (QuickSort ou MergeSort)
- * threshold: Limite para o Insertion Sort
+ * opcoes: Opções de execução (ver opcoes.h):
+ *   - tipoSort/threshold: ordenação dos eventos da varredura
+ *   - numThreads: threads usadas para calcular, em paralelo, os polígonos
+ *     de bombas independentes (entre dois comandos que alteram os
+ *     segmentos do cenário). Os efeitos são sempre aplicados na ordem do
+ *     arquivo, então a saída é a mesma da execução serial. Um lote com uma
+ *     única bomba usa as threads para dividir o próprio cálculo em fatias
+ *     angulares.
+ *   - motorVis: 's' usa a varredura angular; 't' triangula os obstáculos
+ *     uma vez por estado do cenário (refeita só quando eles mudam) e
+ *     responde cada bomba por expansão triangular.
+ *   - toleranciaSimp: se >= 0, cada polígono é simplificado antes dos
+ *     efeitos e do SVG; as contagens de vértices antes e depois são
+ *     impressas ao final.
+ *   - gerarSvg: se false, os SVGs das bombas não são escritos (o
+ *     relatório continua igual).
+ *   - aplicarEfeitos: se false (simulação), os comandos não alteram o
+ *     cenário; o relatório lista, para cada comando, as formas que ele
+ *     atingiria ("SERIA DESTRUÍDA", "SERIA PINTADA", ...). Como os
+ *     segmentos não mudam, todas as bombas formam um único lote e são
+ *     calculadas em paralelo.
+ *
+ * Pós-condição: retorna false se o .qry não pôde ser aberto ou executado
+ * (ex.: falta de memória); nesse caso nenhum comando foi executado.
  */
-void processaArquivoQry(const char* entrada, Lista formas, Gerador gerador, const char* dirSaida, const char* nomeBase, char tipoSort, int threshold);
+bool processaArquivoQry(const char* entrada, Lista formas, Gerador gerador, const char* dirSaida, const char* nomeBase, Opcoes opcoes);
+
+/*________________________________ SESSÃO DE CONSULTAS ________________________________*/
+
+/*
+ * Uma sessão guarda o estado que sobrevive entre blocos de comandos sobre
+ * o mesmo cenário: cache de polígonos, diário de segmentos alterados,
+ * triangulação (motor 't') e pool de threads. processaArquivoQry usa uma
+ * sessão para um único arquivo; o modo servidor (servidor.h) mantém uma
+ * aberta e executa nela cada requisição, como se fossem trechos de um
+ * mesmo .qry (os efeitos de uma valem para as seguintes).
+ */
+typedef void* SessaoQry;
+
+/*
+ * Cria uma sessão sobre o cenário.
+ *
+ * formas, gerador: cenário e gerador de IDs (continuam do chamador). A
+ *   sessão trabalha num cenário persistente que empresta as formas da
+ *   lista: remoções e inserções não mudam a lista, mas pinturas sem
+ *   instantâneos pendentes alteram as formas dela no lugar.
+ * dirSaida: diretório dos SVGs
+ * opcoes: opções de execução (copiadas; podem ser destruídas depois)
+ *
+ * Pré-condição: formas, gerador, dirSaida e opcoes válidos
+ * Pós-condição: retorna a sessão, ou NULL em caso de falha
+ */
+SessaoQry criaSessaoQry(Lista formas, Gerador gerador, const char* dirSaida, Opcoes opcoes);
+
+/*
+ * Constrói desde já os índices que o motor escolhido usa (triangulação no
+ * motor 't'), para que a primeira consulta não pague por eles.
+ *
+ * Pré-condição: s válida
+ * Pós-condição: índices da época atual construídos
+ */
+void preparaIndicesSessaoQry(SessaoQry s);
+
+/*
+ * Lê comandos no formato do .qry até o fim de 'comandos' e os executa.
+ *
+ * nomeBase: prefixo dos SVGs gerados (<nomeBase>-<cmd>-<sufixo>.svg)
+ * relatorio: recebe o texto do relatório (o mesmo do .txt), ou NULL
+ * caminhosSvg: recebe uma linha "svg: <caminho>" por SVG gerado, ou NULL
+ *
+ * Pré-condição: s e comandos válidos
+ * Pós-condição: retorna o número de comandos lidos, ou -1 em caso de falha
+ */
+int executaComandosSessaoQry(SessaoQry s, FILE* comandos, const char* nomeBase, FILE* relatorio, FILE* caminhosSvg);
+
+/*
+ * Avalia pontos candidatos para bombas sobre o cenário atual, sem
+ * alterá-lo e sem SVGs. Lê um ponto "x y" por linha de 'pontos' (linhas
+ * vazias e iniciadas por '#' são ignoradas); o polígono de cada ponto é
+ * calculado com o motor das opções, em paralelo no pool da sessão, e
+ * descartado logo após a contagem.
+ *
+ * relatorio: recebe uma linha por ponto, na ordem de leitura:
+ *   "x y total circulos retangulos linhas textos" (ou NULL)
+ *
+ * Pré-condição: s e pontos válidos
+ * Pós-condição: retorna o número de pontos avaliados, ou -1 em caso de
+ *               falha; o melhor ponto é impresso na saída padrão
+ */
+int avaliaSitiosSessaoQry(SessaoQry s, FILE* pontos, FILE* relatorio);
+
+/*
+ * Guarda um instantâneo do cenário atual (O(1), ver cenario.h) para que
+ * desfazSessaoQry possa voltar a ele. As marcas formam uma pilha limitada;
+ * além do limite, a mais antiga é descartada.
+ *
+ * Pré-condição: s válida
+ * Pós-condição: retorna true se a marca foi guardada
+ */
+bool marcaSessaoQry(SessaoQry s);
+
+/*
+ * Volta o cenário ao estado da última marca (e a remove da pilha). O
+ * gerador de IDs não volta: ids já usados não são reaproveitados.
+ *
+ * Pré-condição: s válida
+ * Pós-condição: retorna false se não havia marca
+ */
+bool desfazSessaoQry(SessaoQry s);
+
+/*
+ * Imprime as estatísticas da sessão (cache, simplificação, triangulação)
+ * e libera seus recursos. O cenário não é liberado.
+ *
+ * Pré-condição: s válida ou NULL
+ * Pós-condição: memória liberada
+ */
+void destroiSessaoQry(SessaoQry s);
 
 #endif
\ No newline at end of file
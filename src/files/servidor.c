@@ -0,0 +1,223 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "servidor.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <signal.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+
+#define MAX_NOME_REQUISICAO 512
+#define TIMEOUT_CLIENTE_S 30    // espera máxima por dados do cliente (ou para enviar)
+
+/*________________________________ FUNÇÕES AUXILIARES INTERNAS ________________________________*/
+
+static double agoraMs(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000.0 + t.tv_nsec / 1e6;
+}
+
+// true se ninguém escuta no socket (a conexão é recusada): pode ser removido
+static bool socketAbandonado(const struct sockaddr_un *endereco) {
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return false;
+    }
+    bool recusado = connect(fd, (const struct sockaddr*) endereco, sizeof(*endereco)) < 0 &&
+                    errno == ECONNREFUSED;
+    close(fd);
+    return recusado;
+}
+
+static int abreSocket(const char* caminho) {
+    struct sockaddr_un endereco;
+    if (strlen(caminho) >= sizeof(endereco.sun_path)) {
+        fprintf(stderr, "Erro: caminho do socket muito longo: %s\n", caminho);
+        return -1;
+    }
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        perror("Erro: socket");
+        return -1;
+    }
+
+    memset(&endereco, 0, sizeof(endereco));
+    endereco.sun_family = AF_UNIX;
+    strcpy(endereco.sun_path, caminho);
+
+    // Só substitui um socket antigo (ex.: de um servidor que caiu); qualquer
+    // outro arquivo no caminho é do usuário e não pode ser apagado
+    struct stat st;
+    if (lstat(caminho, &st) == 0) {
+        if (!S_ISSOCK(st.st_mode)) {
+            fprintf(stderr, "Erro: %s existe e nao e um socket; escolha outro caminho.\n", caminho);
+            close(fd);
+            return -1;
+        }
+        if (!socketAbandonado(&endereco)) {
+            fprintf(stderr, "Erro: servidor ja ativo em %s.\n", caminho);
+            close(fd);
+            return -1;
+        }
+        unlink(caminho);
+    }
+
+    if (bind(fd, (struct sockaddr*) &endereco, sizeof(endereco)) < 0 || listen(fd, 8) < 0) {
+        perror("Erro: bind/listen do socket");
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Limita o tempo que uma leitura ou escrita no cliente pode bloquear
+static void limitaEsperaCliente(int fd) {
+    struct timeval limite = { TIMEOUT_CLIENTE_S, 0 };
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &limite, sizeof(limite));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &limite, sizeof(limite));
+}
+
+/*
+ * Lê as linhas da requisição até "." ou o fim da escrita do cliente.
+ * Retorna o texto (terminado em '\0', liberar com free) e seu tamanho,
+ * ou NULL se a leitura falhou ou o cliente ficou TIMEOUT_CLIENTE_S sem
+ * enviar nada (nesse caso 'expirou' fica true).
+ */
+static char* leRequisicao(FILE* entrada, size_t *tamanho, bool *expirou) {
+    *expirou = false;
+    char *texto = NULL;
+    FILE *buffer = open_memstream(&texto, tamanho);
+    if (!buffer) return NULL;
+
+    char *linha = NULL;
+    size_t cap = 0;
+    while (getline(&linha, &cap, entrada) > 0) {
+        if (strcmp(linha, ".\n") == 0 || strcmp(linha, ".\r\n") == 0 || strcmp(linha, ".") == 0) break;
+        fputs(linha, buffer);
+    }
+    bool falhou = ferror(entrada);
+    *expirou = falhou && (errno == EAGAIN || errno == EWOULDBLOCK);
+    free(linha);
+    fclose(buffer);
+    if (falhou) {
+        free(texto);
+        return NULL;
+    }
+    return texto;
+}
+
+// Requisição formada só pela palavra dada (ex.: "sair", "desfaz")
+static bool ehPedido(const char* texto, const char* pedido) {
+    char palavra[16];
+    char resto[2];
+    return sscanf(texto, "%15s %1s", palavra, resto) == 1 && strcmp(palavra, pedido) == 0;
+}
+
+/*
+ * Executa uma requisição na sessão e escreve a resposta.
+ * Retorna false se a requisição pediu o encerramento do servidor.
+ */
+static bool atendeConexao(int fd, SessaoQry sessao, const char* nomeBase, int numero) {
+    limitaEsperaCliente(fd);
+    FILE *entrada = fdopen(fd, "r");
+    if (!entrada) {
+        close(fd);
+        return true;
+    }
+    int fdSaida = dup(fd);
+    FILE *saida = (fdSaida >= 0) ? fdopen(fdSaida, "w") : NULL;
+    if (!saida) {
+        if (fdSaida >= 0) close(fdSaida);
+        fclose(entrada);
+        return true;
+    }
+
+    size_t tamanho = 0;
+    bool expirou = false;
+    char *texto = leRequisicao(entrada, &tamanho, &expirou);
+    bool continua = true;
+
+    if (expirou) {
+        // Cliente parado: descarta a conexão para atender os próximos
+        printf("Requisicao %d: cliente sem enviar dados por %d s; conexao descartada\n",
+               numero, TIMEOUT_CLIENTE_S);
+        fflush(stdout);
+    } else if (!texto) {
+        fprintf(saida, "erro: falha ao ler a requisicao\n");
+    } else if (ehPedido(texto, "sair")) {
+        fprintf(saida, "fim 0 0\n");
+        continua = false;
+    } else if (ehPedido(texto, "desfaz")) {
+        if (desfazSessaoQry(sessao)) {
+            fprintf(saida, "desfeito\n");
+        } else {
+            fprintf(saida, "erro: nada a desfazer\n");
+        }
+        fprintf(saida, "fim 0 0\n");
+    } else {
+        double inicio = agoraMs();
+        int comandos = 0;
+
+        // fmemopen não aceita buffer vazio
+        FILE *cmds = (tamanho > 0) ? fmemopen(texto, tamanho, "r") : NULL;
+        if (cmds) {
+            marcaSessaoQry(sessao);
+            char nomeReq[MAX_NOME_REQUISICAO];
+            snprintf(nomeReq, sizeof(nomeReq), "%s-srv%d", nomeBase, numero);
+            comandos = executaComandosSessaoQry(sessao, cmds, nomeReq, saida, saida);
+            fclose(cmds);
+        }
+
+        double ms = agoraMs() - inicio;
+        fprintf(saida, "fim %d %.3f\n", comandos, ms);
+        printf("Requisicao %d: %d comandos em %.3f ms\n", numero, comandos, ms);
+        fflush(stdout);
+    }
+
+    free(texto);
+    fclose(saida);
+    fclose(entrada);
+    return continua;
+}
+
+/*________________________________ SERVIDOR ________________________________*/
+
+int executaServidor(const char* caminhoSocket, SessaoQry sessao, const char* nomeBase) {
+    if (!caminhoSocket || !sessao || !nomeBase) return -1;
+
+    // Um cliente que fecha a conexão antes da resposta não derruba o servidor
+    signal(SIGPIPE, SIG_IGN);
+
+    int fdServidor = abreSocket(caminhoSocket);
+    if (fdServidor < 0) return -1;
+
+    printf("Servidor: aguardando consultas em %s\n", caminhoSocket);
+    fflush(stdout);
+
+    int numero = 0;
+    bool continua = true;
+    while (continua) {
+        int fd = accept(fdServidor, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            perror("Erro: accept");
+            break;
+        }
+        continua = atendeConexao(fd, sessao, nomeBase, ++numero);
+    }
+
+    close(fdServidor);
+    unlink(caminhoSocket);
+    printf("Servidor: encerrado apos %d requisicoes\n", numero);
+    return 0;
+}
@@ -0,0 +1,46 @@
+#ifndef SERVIDOR_H
+#define SERVIDOR_H
+
+#include "processaQry.h"
+
+/*
+*        MÓDULO DO MODO SERVIDOR (-serve)
+*
+*        Mantém o cenário carregado e atende consultas por um socket local
+*        (Unix domain), evitando reler o .geo a cada bomba.
+*
+*        Protocolo (uma requisição por conexão):
+*        - o cliente envia linhas no formato do .qry (d, p, cln, a) e
+*          termina com uma linha contendo só "." ou fechando a escrita;
+*        - o servidor executa as linhas na sessão e devolve o texto do
+*          relatório, uma linha "svg: <caminho>" por SVG gerado e, por
+*          fim, "fim <comandos> <milissegundos>"; depois fecha a conexão.
+*        - uma requisição com a única linha "desfaz" volta o cenário ao
+*          estado anterior à última requisição (até 16 níveis; usa os
+*          instantâneos da sessão, sem copiar o cenário);
+*        - uma requisição com a única linha "sair" encerra o servidor;
+*        - um cliente que passa 30 s sem enviar dados (sem "." nem fechar
+*          a escrita) tem a conexão descartada, sem executar nada, para não
+*          travar os demais.
+*
+*        Os SVGs da requisição k se chamam <nomeBase>-srv<k>-<cmd>-<sufixo>.svg.
+*        Os efeitos de uma requisição (destruições, clones, anteparos)
+*        permanecem para as seguintes, como num .qry contínuo.
+*/
+
+/*
+Atende requisições até receber "sair".
+
+* caminhoSocket: caminho do socket (um socket abandonado nesse caminho é
+  substituído; se outro servidor escuta nele ou se há outro tipo de
+  arquivo, o servidor não inicia)
+* sessao: sessão sobre o cenário já carregado
+* nomeBase: prefixo dos nomes dos SVGs
+
+Pré-condição: caminhoSocket, sessao e nomeBase válidos
+Pós-condição: retorna 0 ao encerrar normalmente, ou -1 se o socket não
+              pôde ser criado; o arquivo do socket é removido ao final
+*/
+int executaServidor(const char* caminhoSocket, SessaoQry sessao, const char* nomeBase);
+
+#endif
@@ -9,6 +9,10 @@
 #include "lista.h"
 #include "formas.h"
 #include "gerador.h"
+#include "opcoes.h"
+#include "coordenada.h"
+#include "servidor.h"
+#include "loteqry.h"
 
 #define PATH_LEN 512
 #define FILE_NAME_LEN 256
@@ -88,6 +92,92 @@ char* criar_nome_saida(const char* dir_saida, const char* nome_base, const char*
     return caminho;
 }
 
+// Insere no fim da lista uma cópia do caminho de um .qry
+static void adicionaConsulta(Lista consultas, const char* arqQry) {
+    char *copia = malloc(strlen(arqQry) + 1);
+    if (!copia) return;
+    strcpy(copia, arqQry);
+    insereListaFim(consultas, copia);
+}
+
+// Dados comuns a todas as consultas de uma execução
+typedef struct {
+    const char *dirEntrada;
+    const char *dirSaida;
+    const char *nomeBaseGeo;
+    Lista formas;
+    Opcoes opcoes;
+} ContextoConsulta;
+
+// Processa um .qry sobre o cenário (no processo atual); retorna o código
+// de saída da consulta (EXIT_FAILURE se o .qry não pôde ser executado)
+static int processaConsulta(const char* arqQry, void* dados) {
+    ContextoConsulta *c = (ContextoConsulta*) dados;
+    char* pathQryCompleto = monta_caminho(c->dirEntrada, arqQry);
+    char* nomeBaseQry = obter_nome_base(arqQry);
+    
+    // O nome base de saída para o QRY geralmente combina geo + qry
+    // Ex: cidade-consulta1
+    char nomeSaidaCombinado[512];
+    sprintf(nomeSaidaCombinado, "%s-%s", c->nomeBaseGeo, nomeBaseQry);
+
+    printf("Processando Consultas: %s\n", pathQryCompleto);
+    
+    // Inicializa gerador de IDs (para novos elementos criados pelo QRY)
+    int maiorId = calculaMaiorId(c->formas);
+    Gerador gerador = criaGerador(maiorId + 1);
+
+    bool ok = processaArquivoQry(pathQryCompleto, c->formas, gerador, c->dirSaida, nomeSaidaCombinado, c->opcoes);
+
+    destroiGerador(gerador);
+    free(pathQryCompleto);
+    free(nomeBaseQry);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// Avalia os pontos candidatos de arqSitios sobre o cenário do .geo;
+// o relatório vai para <geo>-<sitios>.txt. Retorna false se falhou.
+static bool avaliaSitios(const char* arqSitios, ContextoConsulta* c) {
+    char* pathSitios = monta_caminho(c->dirEntrada, arqSitios);
+    char* nomeBaseSitios = obter_nome_base(arqSitios);
+    bool ok = false;
+
+    printf("Avaliando Sitios: %s\n", pathSitios);
+    FILE* pontos = fopen(pathSitios, "r");
+    if (!pontos) {
+        fprintf(stderr, "ERRO: Nao abriu arquivo de sitios: %s\n", pathSitios);
+        free(pathSitios);
+        free(nomeBaseSitios);
+        return false;
+    }
+
+    char nomeTxt[FILE_NAME_LEN * 2];
+    snprintf(nomeTxt, sizeof(nomeTxt), "%s-%s.txt", c->nomeBaseGeo, nomeBaseSitios);
+    char* pathTxt = monta_caminho(c->dirSaida, nomeTxt);
+    FILE* relatorio = fopen(pathTxt, "w");
+    if (!relatorio) {
+        fprintf(stderr, "Aviso: nao foi possivel criar %s; so o melhor sitio sera impresso.\n", pathTxt);
+    }
+
+    int maiorId = calculaMaiorId(c->formas);
+    Gerador gerador = criaGerador(maiorId + 1);
+    SessaoQry sessao = criaSessaoQry(c->formas, gerador, c->dirSaida, c->opcoes);
+    if (sessao) {
+        ok = avaliaSitiosSessaoQry(sessao, pontos, relatorio) >= 0;
+        destroiSessaoQry(sessao);
+    } else {
+        fprintf(stderr, "ERRO: falha ao criar a sessao de avaliacao de sitios.\n");
+    }
+
+    destroiGerador(gerador);
+    if (relatorio) fclose(relatorio);
+    fclose(pontos);
+    free(pathTxt);
+    free(pathSitios);
+    free(nomeBaseSitios);
+    return ok;
+}
+
 // --- MAIN ---
 
 int main(int argc, char *argv[]) {
@@ -95,11 +185,18 @@ int main(int argc, char *argv[]) {
     char *dirEntrada = NULL; // Opcional (-e)
     char *dirSaida = NULL;   // Obrigatório (-o)
     char *arqGeo = NULL;     // Obrigatório (-f)
-    char *arqQry = NULL;     // Opcional (-q)
+    Lista consultas = criaLista(); // Opcional (-q, repetível, e -qlist)
+    int maxParalelos = 1;    // Opcional (-jobs): consultas simultâneas
+    char *socketServidor = NULL; // Opcional (-serve): modo servidor
+    char *arqSitios = NULL;  // Opcional (-sites): pontos candidatos a avaliar
     
-    // Parâmetros de ordenação (Regra 1 / Problema 1)
-    char tipoOrdenacao = 'q'; // Default: QuickSort
-    int thresholdInsert = 10; // Default: 10
+    // Parâmetros de ordenação (Regra 1 / Problema 1), threads e motor de visibilidade
+    Opcoes opcoes = criaOpcoes();
+    if (!opcoes || !consultas) {
+        destroiOpcoes(opcoes);
+        destroiLista(consultas);
+        return EXIT_FAILURE;
+    }
     
     // 1. Parse dos argumentos
     int i = 1;
@@ -114,18 +211,51 @@ int main(int argc, char *argv[]) {
             if (i+1 < argc) dirSaida = argv[++i];
         }
         else if (strcmp(argv[i], "-q") == 0) {
-            if (i+1 < argc) arqQry = argv[++i];
+            if (i+1 < argc) adicionaConsulta(consultas, argv[++i]);
+        }
+        else if (strcmp(argv[i], "-qlist") == 0) {
+            // Arquivo com um .qry por linha
+            if (i+1 < argc) leListaQry(argv[++i], consultas);
+        }
+        else if (strcmp(argv[i], "-jobs") == 0) {
+            // Máximo de consultas executadas ao mesmo tempo (uma por processo)
+            if (i+1 < argc) maxParalelos = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-serve") == 0) {
+            // Mantém o cenário carregado e atende consultas por um socket local
+            if (i+1 < argc) socketServidor = argv[++i];
+        }
+        else if (strcmp(argv[i], "-sites") == 0) {
+            // Conta as formas que cada ponto do arquivo atingiria (sem SVG)
+            if (i+1 < argc) arqSitios = argv[++i];
         }
         else if (strcmp(argv[i], "-to") == 0) {
-            // Tipo de ordenação (m ou q)
-            if (i+1 < argc) {
-                char tipo = argv[++i][0];
-                if (tipo == 'm' || tipo == 'q') tipoOrdenacao = tipo;
-            }
+            // Tipo de ordenação (m, q ou r)
+            if (i+1 < argc) setTipoSortOpcoes(opcoes, argv[++i][0]);
         }
         else if (strcmp(argv[i], "-in") == 0) {
             // Threshold do Insertion Sort
-            if (i+1 < argc) thresholdInsert = atoi(argv[++i]);
+            if (i+1 < argc) setThresholdOpcoes(opcoes, atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "-threads") == 0) {
+            // Threads para a visibilidade (bombas independentes ou fatias angulares)
+            if (i+1 < argc) setNumThreadsOpcoes(opcoes, atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "-vis") == 0) {
+            // Motor de visibilidade: s (varredura) ou t (expansão triangular)
+            if (i+1 < argc) setMotorVisOpcoes(opcoes, argv[++i][0]);
+        }
+        else if (strcmp(argv[i], "-simp") == 0) {
+            // Tolerância da simplificação dos polígonos de visibilidade
+            if (i+1 < argc) setToleranciaSimpOpcoes(opcoes, atof(argv[++i]));
+        }
+        else if (strcmp(argv[i], "-nosvg") == 0 || strcmp(argv[i], "-report-only") == 0) {
+            // Só o relatório .txt, sem nenhum SVG
+            setGerarSvgOpcoes(opcoes, false);
+        }
+        else if (strcmp(argv[i], "-whatif") == 0) {
+            // Simulação: relata o que cada bomba atingiria, sem alterar o cenário
+            setAplicarEfeitosOpcoes(opcoes, false);
         }
         i++;
     }
@@ -133,16 +263,42 @@ int main(int argc, char *argv[]) {
     // 2. Validação básica
     if (!arqGeo || !dirSaida) {
         fprintf(stderr, "ERRO FATAL: Argumentos -f (geo) e -o (saida) sao obrigatorios.\n");
+        destroiListaCompleta(consultas, free);
+        destroiOpcoes(opcoes);
         return EXIT_FAILURE;
     }
 
+    if (socketServidor && !listaVazia(consultas)) {
+        fprintf(stderr, "Aviso: -q/-qlist ignorados no modo servidor (-serve).\n");
+        destroiListaCompleta(consultas, free);
+        consultas = criaLista();
+    }
+
     // Caso o usuário não passe -e, usamos ponto atual "."
     if (!dirEntrada) dirEntrada = ".";
 
     printf("\n=== INICIANDO PROJETO ===\n");
-    printf("Geo: %s | Qry: %s\n", arqGeo, arqQry ? arqQry : "Nao informado");
+    int qtdConsultas = tamanhoLista(consultas);
+    if (qtdConsultas <= 1) {
+        printf("Geo: %s | Qry: %s\n", arqGeo, qtdConsultas == 1 ? (char*) getListaInicio(consultas) : "Nao informado");
+    } else {
+        printf("Geo: %s | Qry: %d arquivos (ate %d simultaneos)\n", arqGeo, qtdConsultas, maxParalelos < 1 ? 1 : maxParalelos);
+    }
     printf("Dirs: Entrada='%s' Saida='%s'\n", dirEntrada, dirSaida);
-    printf("Ordenacao: Tipo='%c' Threshold=%d\n\n", tipoOrdenacao, thresholdInsert);
+    printf("Ordenacao: Tipo='%c' Threshold=%d\n", getTipoSortOpcoes(opcoes), getThresholdOpcoes(opcoes));
+    printf("Threads: %d\n", getNumThreadsOpcoes(opcoes));
+    printf("Coordenadas: %s\n", descricaoCoord());
+    printf("Visibilidade: %s\n", (getMotorVisOpcoes(opcoes) == 't') ? "expansao triangular" : "varredura angular");
+    if (getToleranciaSimpOpcoes(opcoes) >= 0.0) {
+        printf("Simplificacao: tolerancia=%g\n", getToleranciaSimpOpcoes(opcoes));
+    }
+    if (!getGerarSvgOpcoes(opcoes)) {
+        printf("SVG: desligado (somente relatorio)\n");
+    }
+    if (!getAplicarEfeitosOpcoes(opcoes)) {
+        printf("Simulacao: efeitos das bombas nao aplicados\n");
+    }
+    printf("\n");
 
     // 3. Processamento GEO
     char* pathGeoCompleto = monta_caminho(dirEntrada, arqGeo);
@@ -153,43 +309,57 @@ int main(int argc, char *argv[]) {
     
     if (!formas) {
         fprintf(stderr, "ERRO: Nao foi possivel ler o arquivo geo.\n");
+        destroiListaCompleta(consultas, free);
         free(pathGeoCompleto);
         free(nomeBaseGeo);
+        destroiOpcoes(opcoes);
         return EXIT_FAILURE;
     }
 
     // Gera SVG inicial (Apenas o .geo)
-    char* pathSvgGeo = criar_nome_saida(dirSaida, nomeBaseGeo, NULL);
-    printf("Gerando SVG Inicial: %s\n", pathSvgGeo);
-    // Nota: Verifique se sua geraSVGCompleto aceita width/height ou ajusta automático
-    geraSVGCompleto(pathSvgGeo, formas, 800, 600); 
-    free(pathSvgGeo);
-
-    // 4. Processamento QRY (se existir)
-    if (arqQry) {
-        char* pathQryCompleto = monta_caminho(dirEntrada, arqQry);
-        char* nomeBaseQry = obter_nome_base(arqQry);
-        
-        // O nome base de saída para o QRY geralmente combina geo + qry
-        // Ex: cidade-consulta1
-        char nomeSaidaCombinado[512];
-        sprintf(nomeSaidaCombinado, "%s-%s", nomeBaseGeo, nomeBaseQry);
-
-        printf("Processando Consultas: %s\n", pathQryCompleto);
-        
-        // Inicializa gerador de IDs (para novos elementos criados pelo QRY)
+    if (getGerarSvgOpcoes(opcoes)) {
+        char* pathSvgGeo = criar_nome_saida(dirSaida, nomeBaseGeo, NULL);
+        printf("Gerando SVG Inicial: %s\n", pathSvgGeo);
+        // Nota: Verifique se sua geraSVGCompleto aceita width/height ou ajusta automático
+        geraSVGCompleto(pathSvgGeo, formas, 800, 600); 
+        free(pathSvgGeo);
+    }
+
+    // 4. Avaliação de sítios, processamento QRY (se existir) ou modo servidor
+    int status = EXIT_SUCCESS;
+    ContextoConsulta contexto = { dirEntrada, dirSaida, nomeBaseGeo, formas, opcoes };
+    if (arqSitios && !avaliaSitios(arqSitios, &contexto)) {
+        status = EXIT_FAILURE;
+    }
+
+    if (socketServidor) {
         int maiorId = calculaMaiorId(formas);
         Gerador gerador = criaGerador(maiorId + 1);
+        SessaoQry sessao = criaSessaoQry(formas, gerador, dirSaida, opcoes);
 
-        // OBS: Se você já implementou o Sort, você passaria 'tipoOrdenacao' e 'thresholdInsert'
-        // para dentro do processaArquivoQry ou salvaria em variáveis globais/contexto.
-        // Por enquanto, mantemos a chamada padrão:
-processaArquivoQry(pathQryCompleto, formas, gerador, dirSaida, nomeSaidaCombinado, tipoOrdenacao, thresholdInsert);
-
+        if (sessao) {
+            preparaIndicesSessaoQry(sessao);
+            if (executaServidor(socketServidor, sessao, nomeBaseGeo) != 0) {
+                status = EXIT_FAILURE;
+            }
+            destroiSessaoQry(sessao);
+        } else {
+            fprintf(stderr, "ERRO: falha ao criar a sessao do servidor.\n");
+            status = EXIT_FAILURE;
+        }
         destroiGerador(gerador);
-        free(pathQryCompleto);
-        free(nomeBaseQry);
     }
+    else if (!listaVazia(consultas)) {
+        // Cada .qry vê o cenário como saiu do .geo (ver loteqry.h)
+        int falhas = executaLoteQry(consultas, maxParalelos, processaConsulta, &contexto);
+        if (falhas > 0) {
+            fprintf(stderr, "ERRO: %d de %d consultas falharam.\n", falhas, qtdConsultas);
+            status = EXIT_FAILURE;
+        }
+    }
+
+    // Erro introduzido pela representação compacta (0 no modo double)
+    printf("Coordenadas: erro maximo de conversao = %g\n", erroMaximoCoord());
 
     // 5. Limpeza Final
     // Assumindo que destroiListaCompleta recebe a função de destruir o dado (void*)
@@ -197,7 +367,9 @@ processaArquivoQry(pathQryCompleto, formas, gerador, dirSaida, nomeSaidaCombinad
     
     free(pathGeoCompleto);
     free(nomeBaseGeo);
+    destroiListaCompleta(consultas, free);
+    destroiOpcoes(opcoes);
 
     printf("\n=== FIM DO PROCESSAMENTO ===\n");
-    return EXIT_SUCCESS;
+    return status;
 }
\ No newline at end of file